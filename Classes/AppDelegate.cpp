@@ -1,7 +1,10 @@
 
 #include "AppDelegate.h"
 #include "HelloWorldScene.h"
-#include "scenes/GameScene.h"
+#include "scenes/BootScene.h"
+#include "managers/FrameRateManager.h"
+#include "utils/EventLog.h"
+#include "utils/Trace.h"
 
  // #define USE_AUDIO_ENGINE 1
  // #define USE_SIMPLE_AUDIO_ENGINE 1
@@ -49,7 +52,51 @@ static int register_all_packages()
     return 0;
 }
 
+#if TRACE_ENABLED
+/**
+ * 用导演的帧事件把每帧切成 更新 / 遍历 / 渲染 三段记入追踪
+ * 暂停时导演不派发更新事件，这些帧不记录
+ */
+static void installFrameTracing(Director* director)
+{
+    static uint64_t frameStartNs = 0;
+    static uint64_t updateEndNs = 0;
+    static uint64_t visitEndNs = 0;
+
+    Trace::setThreadName("cocos main");
+    auto dispatcher = director->getEventDispatcher();
+    dispatcher->addCustomEventListener(Director::EVENT_BEFORE_UPDATE, [](EventCustom*) {
+        frameStartNs = Trace::nowNs();
+        updateEndNs = 0;
+        visitEndNs = 0;
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_AFTER_UPDATE, [](EventCustom*) {
+        if (frameStartNs == 0) return;
+        updateEndNs = Trace::nowNs();
+        Trace::recordComplete("Scheduler::update", frameStartNs, updateEndNs);
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_AFTER_VISIT, [](EventCustom*) {
+        if (updateEndNs == 0) return;
+        visitEndNs = Trace::nowNs();
+        Trace::recordComplete("Scene::visit", updateEndNs, visitEndNs);
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW, [](EventCustom*) {
+        if (visitEndNs == 0) return;
+        uint64_t drawEndNs = Trace::nowNs();
+        Trace::recordComplete("Renderer::render", visitEndNs, drawEndNs);
+        Trace::recordComplete("Frame", frameStartNs, drawEndNs);
+        frameStartNs = 0;
+    });
+}
+#endif
+
 bool AppDelegate::applicationDidFinishLaunching() {
+    // 可交互时间的起点
+    double launchStartMs = utils::getTimeInMilliseconds();
+
+    // 事件日志的即时回显走 cocos2d::log，Android 上进入 logcat
+    EventLog::setEchoOutput([](const char* line) { cocos2d::log("%s", line); });
+
     auto director = Director::getInstance();
     auto glview = director->getOpenGLView();
     if (!glview) {
@@ -61,8 +108,15 @@ bool AppDelegate::applicationDidFinishLaunching() {
 
     director->setDisplayStats(false);
     director->setAnimationInterval(1.0f / 60);
+    // 以上为满帧率；桌面静止时降帧，触摸或动画开始时恢复
+    FrameRateManager::getInstance()->install(director);
 
-    auto scene = GameScene::create();
+#if TRACE_ENABLED
+    installFrameTracing(director);
+#endif
+
+    // 启动场景第一帧即显示，素材纹理、第一局发牌与牌面预合成完成后切换到 GameScene
+    auto scene = BootScene::create(launchStartMs);
     director->runWithScene(scene);
 
     return true;
@@ -71,6 +125,15 @@ bool AppDelegate::applicationDidFinishLaunching() {
 void AppDelegate::applicationDidEnterBackground() {
     Director::getInstance()->stopAnimation();
 
+#if EVENT_LOG_LEVEL > 0
+    // 进入后台时保留最近的事件日志，用 tools/logdump 解读
+    EventLog::writeDump(FileUtils::getInstance()->getWritablePath() + "events.bin");
+#endif
+#if TRACE_ENABLED
+    // 区间追踪导出为 Chrome trace JSON，可在 ui.perfetto.dev 打开
+    Trace::writeChromeTrace(FileUtils::getInstance()->getWritablePath() + "trace.json");
+#endif
+
 #if USE_AUDIO_ENGINE
     AudioEngine::pauseAll();
 #elif USE_SIMPLE_AUDIO_ENGINE
@@ -81,6 +144,7 @@ void AppDelegate::applicationDidEnterBackground() {
 
 void AppDelegate::applicationWillEnterForeground() {
     Director::getInstance()->startAnimation();
+    FrameRateManager::getInstance()->wake();
 
 #if USE_AUDIO_ENGINE
     AudioEngine::resumeAll();
@@ -1,17 +1,62 @@
 #include "LevelConfigLoader.h"
+#include "LevelJsonParser.h"
 #include "cocos2d.h"
-#include "json/document.h"
-#include "json/stringbuffer.h"
-#include "json/writer.h"
 
 USING_NS_CC;
 
+const char* const LevelConfigLoader::DEFAULT_PACK_FILE = "levels.pack";
+
 LevelConfigLoader::LevelConfigLoader()
+    : _packTried(false)
+{
+}
+
+bool LevelConfigLoader::openLevelPack(const std::string& filename)
+{
+    _packTried = true;
+    std::string fullPath = FileUtils::getInstance()->fullPathForFilename(filename);
+    if (fullPath.empty()) {
+        CCLOG("LevelConfigLoader: level pack not found: %s", filename.c_str());
+        return false;
+    }
+
+    // ӳӳ䣻APK ڵԴǶļڴһ
+    if (_levelPack.openFile(fullPath)) {
+        return true;
+    }
+    Data data = FileUtils::getInstance()->getDataFromFile(fullPath);
+    if (data.isNull()) {
+        CCLOG("LevelConfigLoader: cannot read level pack: %s", fullPath.c_str());
+        return false;
+    }
+    std::vector<uint8_t> buffer(data.getBytes(), data.getBytes() + data.getSize());
+    if (!_levelPack.openBuffer(std::move(buffer))) {
+        CCLOG("LevelConfigLoader: invalid level pack: %s", fullPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void LevelConfigLoader::ensurePackOpened()
 {
+    if (!_packTried) {
+        openLevelPack(DEFAULT_PACK_FILE);
+    }
+}
+
+bool LevelConfigLoader::getLevelConfig(int levelId, LevelConfig& outConfig)
+{
+    ensurePackOpened();
+    return _levelPack.getLevelConfig(levelId, outConfig);
 }
 
 LevelConfig* LevelConfigLoader::loadLevelConfig(int levelId)
 {
+    LevelConfig view;
+    if (getLevelConfig(levelId, view)) {
+        return new LevelConfig(view);
+    }
+
     // ļlevel_1.json
     std::string filename = StringUtils::format("level_%d.json", levelId);
     return parseLevelConfig(filename);
@@ -33,67 +78,9 @@ LevelConfig* LevelConfigLoader::parseLevelConfig(const std::string& filename)
         return nullptr;
     }
 
-    rapidjson::Document doc;
-    doc.Parse(content.c_str());
-    if (doc.HasParseError()) {
-        CCLOG("LevelConfigLoader: JSON parse error: %s", doc.GetParseError());
-        return nullptr;
-    }
-
-    LevelConfig* levelConfig = new LevelConfig();
-
-    // 
-    if (doc.HasMember("Playfield") && doc["Playfield"].IsArray()) {
-        std::vector<LevelConfig::CardConfig> playFieldCards;
-        const rapidjson::Value& playfieldArray = doc["Playfield"];
-        for (rapidjson::SizeType i = 0; i < playfieldArray.Size(); i++) {
-            const rapidjson::Value& cardObj = playfieldArray[i];
-            LevelConfig::CardConfig cardConfig;
-            if (cardObj.HasMember("CardFace") && cardObj["CardFace"].IsInt()) {
-                cardConfig.face = static_cast<CardFaceType>(cardObj["CardFace"].GetInt());
-            }
-            if (cardObj.HasMember("CardSuit") && cardObj["CardSuit"].IsInt()) {
-                cardConfig.suit = static_cast<CardSuitType>(cardObj["CardSuit"].GetInt());
-            }
-            if (cardObj.HasMember("Position") && cardObj["Position"].IsObject()) {
-                const rapidjson::Value& posObj = cardObj["Position"];
-                if (posObj.HasMember("x") && posObj["x"].IsNumber() &&
-                    posObj.HasMember("y") && posObj["y"].IsNumber()) {
-                    cardConfig.position.x = posObj["x"].GetFloat();
-                    cardConfig.position.y = posObj["y"].GetFloat();
-                }
-            }
-            playFieldCards.push_back(cardConfig);
-        }
-        levelConfig->setPlayFieldCards(playFieldCards);
+    LevelConfig* levelConfig = LevelJsonParser::parse(content);
+    if (!levelConfig) {
+        CCLOG("LevelConfigLoader: JSON parse error: %s", filename.c_str());
     }
-
-    // 
-    if (doc.HasMember("Stack") && doc["Stack"].IsArray()) {
-        std::vector<LevelConfig::CardConfig> stackCards;
-        const rapidjson::Value& stackArray = doc["Stack"];
-        for (rapidjson::SizeType i = 0; i < stackArray.Size(); i++) {
-            const rapidjson::Value& cardObj = stackArray[i];
-            LevelConfig::CardConfig cardConfig;
-            if (cardObj.HasMember("CardFace") && cardObj["CardFace"].IsInt()) {
-                cardConfig.face = static_cast<CardFaceType>(cardObj["CardFace"].GetInt());
-            }
-            if (cardObj.HasMember("CardSuit") && cardObj["CardSuit"].IsInt()) {
-                cardConfig.suit = static_cast<CardSuitType>(cardObj["CardSuit"].GetInt());
-            }
-            // ƶѵλͨɳ㣬Ƕȡеλ
-            if (cardObj.HasMember("Position") && cardObj["Position"].IsObject()) {
-                const rapidjson::Value& posObj = cardObj["Position"];
-                if (posObj.HasMember("x") && posObj["x"].IsNumber() &&
-                    posObj.HasMember("y") && posObj["y"].IsNumber()) {
-                    cardConfig.position.x = posObj["x"].GetFloat();
-                    cardConfig.position.y = posObj["y"].GetFloat();
-                }
-            }
-            stackCards.push_back(cardConfig);
-        }
-        levelConfig->setStackCards(stackCards);
-    }
-
     return levelConfig;
-}
\ No newline at end of file
+}
@@ -3,27 +3,48 @@
 #define LEVEL_CONFIG_LOADER_H
 
 #include "../models/LevelConfig.h"
+#include "LevelPack.h"
 
 /**
  * ؿü
- * ļJSONعؿ
+ * ȴӶƹؿlevels.packȡؿûеĹؿٻ˵ level_N.json
+ * ڿڵ޸ĳһض±ؿ
  */
 class LevelConfigLoader
 {
 public:
+    static const char* const DEFAULT_PACK_FILE;
+
     LevelConfigLoader();
     ~LevelConfigLoader() = default;
 
+    /**
+     * 򿪹ؿ״μعؿʱԶԴĬϹؿ
+     * @return ؿڻʽʱ false˺ֻ JSON 
+     */
+    bool openLevelPack(const std::string& filename = DEFAULT_PACK_FILE);
+
+    /**
+     * ȡؿͼڴ棬outConfig ָؿڴ
+     * @return ؿûиùؿʱ false
+     */
+    bool getLevelConfig(int levelId, LevelConfig& outConfig);
+
     /**
      * ָؿID
      * @param levelId ؿID
-     * @return ؿöʧܷnullptr
+     * @return ؿöɵ÷ deleteʧܻЧʱnullptr
      */
     LevelConfig* loadLevelConfig(int levelId);
 
 private:
+    void ensurePackOpened();
+
     // JSONļ
     LevelConfig* parseLevelConfig(const std::string& filename);
+
+    LevelPack _levelPack;
+    bool _packTried;
 };
 
-#endif // LEVEL_CONFIG_LOADER_H
\ No newline at end of file
+#endif // LEVEL_CONFIG_LOADER_H
@@ -0,0 +1,66 @@
+#include "LevelJsonParser.h"
+#include "../../utils/CoreLog.h"
+#include "json/document.h"
+
+namespace {
+    // 解析 Playfield / Stack 中的一组卡牌；缺少或超出范围的点数、花色使整组无效
+    bool parseCardArray(const rapidjson::Value& cardArray, std::vector<LevelConfig::CardConfig>& cards)
+    {
+        cards.clear();
+        cards.reserve(cardArray.Size());
+        for (rapidjson::SizeType i = 0; i < cardArray.Size(); i++) {
+            const rapidjson::Value& cardObj = cardArray[i];
+            LevelConfig::CardConfig cardConfig;
+            cardConfig.face = CardFaceType::NONE;
+            cardConfig.suit = CardSuitType::NONE;
+            if (cardObj.HasMember("CardFace") && cardObj["CardFace"].IsInt()) {
+                cardConfig.face = static_cast<CardFaceType>(cardObj["CardFace"].GetInt());
+            }
+            if (cardObj.HasMember("CardSuit") && cardObj["CardSuit"].IsInt()) {
+                cardConfig.suit = static_cast<CardSuitType>(cardObj["CardSuit"].GetInt());
+            }
+            if (!isValidCard(cardConfig.face, cardConfig.suit)) {
+                CORE_LOG("LevelJsonParser: invalid card %u (face %d, suit %d)", i,
+                    static_cast<int>(cardConfig.face), static_cast<int>(cardConfig.suit));
+                return false;
+            }
+            if (cardObj.HasMember("Position") && cardObj["Position"].IsObject()) {
+                const rapidjson::Value& posObj = cardObj["Position"];
+                if (posObj.HasMember("x") && posObj["x"].IsNumber() &&
+                    posObj.HasMember("y") && posObj["y"].IsNumber()) {
+                    cardConfig.position.x = posObj["x"].GetFloat();
+                    cardConfig.position.y = posObj["y"].GetFloat();
+                }
+            }
+            cards.push_back(cardConfig);
+        }
+        return true;
+    }
+}
+
+LevelConfig* LevelJsonParser::parse(const std::string& content)
+{
+    rapidjson::Document doc;
+    doc.Parse(content.c_str());
+    if (doc.HasParseError()) {
+        CORE_LOG("LevelJsonParser: JSON parse error: %d", static_cast<int>(doc.GetParseError()));
+        return nullptr;
+    }
+
+    // 主牌区卡牌
+    std::vector<LevelConfig::CardConfig> playFieldCards;
+    if (doc.HasMember("Playfield") && doc["Playfield"].IsArray()) {
+        if (!parseCardArray(doc["Playfield"], playFieldCards)) return nullptr;
+    }
+
+    // 备用牌区卡牌（位置通常由程序计算，这里仍读取配置中的位置）
+    std::vector<LevelConfig::CardConfig> stackCards;
+    if (doc.HasMember("Stack") && doc["Stack"].IsArray()) {
+        if (!parseCardArray(doc["Stack"], stackCards)) return nullptr;
+    }
+
+    LevelConfig* levelConfig = new LevelConfig();
+    levelConfig->setPlayFieldCards(playFieldCards);
+    levelConfig->setStackCards(stackCards);
+    return levelConfig;
+}
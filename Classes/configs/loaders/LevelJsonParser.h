@@ -0,0 +1,22 @@
+#pragma once
+#ifndef LEVEL_JSON_PARSER_H
+#define LEVEL_JSON_PARSER_H
+
+#include "../models/LevelConfig.h"
+#include <string>
+
+/**
+ * 关卡 JSON 解析
+ * 只依赖 rapidjson，不依赖 cocos2d-x，运行时加载器与离线关卡包编译工具共用
+ */
+class LevelJsonParser
+{
+public:
+    /**
+     * 解析一个关卡 JSON 文本
+     * @return 关卡配置对象（由调用方 delete），解析失败或含无效卡牌时返回 nullptr
+     */
+    static LevelConfig* parse(const std::string& content);
+};
+
+#endif // LEVEL_JSON_PARSER_H
@@ -0,0 +1,184 @@
+#include "LevelPack.h"
+#include "../../utils/CoreLog.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    const char PACK_MAGIC[4] = { 'L', 'V', 'P', 'K' };
+    const uint32_t CARD_ALIGNMENT = 16;
+
+    uint32_t alignUp(uint32_t value, uint32_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+LevelPack::LevelPack()
+    : _data(nullptr)
+    , _entries(nullptr)
+    , _cards(nullptr)
+{
+    std::memset(&_header, 0, sizeof(_header));
+}
+
+bool LevelPack::openFile(const std::string& path)
+{
+    close();
+    if (!_file.open(path)) {
+        CORE_LOG("LevelPack: cannot map %s", path.c_str());
+        return false;
+    }
+    if (!validate(_file.data(), _file.size())) {
+        CORE_LOG("LevelPack: invalid level pack %s", path.c_str());
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool LevelPack::openBuffer(std::vector<uint8_t>&& data)
+{
+    close();
+    _buffer = std::move(data);
+    if (!validate(_buffer.data(), _buffer.size())) {
+        CORE_LOG("LevelPack: invalid level pack buffer");
+        close();
+        return false;
+    }
+    return true;
+}
+
+void LevelPack::close()
+{
+    _file.close();
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _data = nullptr;
+    _entries = nullptr;
+    _cards = nullptr;
+    std::memset(&_header, 0, sizeof(_header));
+}
+
+bool LevelPack::validate(const uint8_t* data, size_t size)
+{
+    if (!data || size < sizeof(LevelPackHeader)) return false;
+
+    LevelPackHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) return false;
+    if (header.version != VERSION || header.byteOrder != BYTE_ORDER_MARK) return false;
+    if (header.cardRecordSize != sizeof(LevelConfig::CardConfig)) return false;
+
+    const uint64_t entriesEnd = sizeof(LevelPackHeader) + uint64_t(header.levelCount) * sizeof(LevelPackEntry);
+    if (header.cardOffset < entriesEnd || header.cardOffset % CARD_ALIGNMENT != 0) return false;
+    if (header.cardOffset + uint64_t(header.cardCount) * header.cardRecordSize > size) return false;
+
+    // 打开时一次性校验全部条目，之后取关卡不再做边界检查
+    const LevelPackEntry* entries = reinterpret_cast<const LevelPackEntry*>(data + sizeof(LevelPackHeader));
+    for (uint32_t i = 0; i < header.levelCount; i++) {
+        const LevelPackEntry& entry = entries[i];
+        if (uint64_t(entry.firstCard) + entry.playFieldCount + entry.stackCount > header.cardCount) return false;
+        if (i > 0 && entries[i - 1].levelId >= entry.levelId) return false;
+    }
+
+    // 卡牌记录直接交给模型，点数或花色越界的包整体拒绝
+    const LevelConfig::CardConfig* cards = reinterpret_cast<const LevelConfig::CardConfig*>(data + header.cardOffset);
+    for (uint32_t i = 0; i < header.cardCount; i++) {
+        if (!isValidCard(cards[i].face, cards[i].suit)) return false;
+    }
+
+    _data = data;
+    _header = header;
+    _entries = entries;
+    _cards = cards;
+    return true;
+}
+
+int LevelPack::getLevelIdAt(int index) const
+{
+    if (index < 0 || index >= getLevelCount()) return -1;
+    return _entries[index].levelId;
+}
+
+const LevelPackEntry* LevelPack::findEntry(int levelId) const
+{
+    if (!_entries || _header.levelCount == 0) return nullptr;
+
+    // 关卡ID通常从首关起连续编号，先按偏移直接定位，不连续时再二分查找
+    const int64_t offset = int64_t(levelId) - _entries[0].levelId;
+    if (offset >= 0 && offset < _header.levelCount && _entries[offset].levelId == levelId) {
+        return &_entries[offset];
+    }
+
+    const LevelPackEntry* end = _entries + _header.levelCount;
+    const LevelPackEntry* it = std::lower_bound(_entries, end, levelId,
+        [](const LevelPackEntry& entry, int id) { return entry.levelId < id; });
+    return (it != end && it->levelId == levelId) ? it : nullptr;
+}
+
+bool LevelPack::getLevelConfig(int levelId, LevelConfig& outConfig) const
+{
+    const LevelPackEntry* entry = findEntry(levelId);
+    if (!entry) return false;
+    const LevelConfig::CardConfig* cards = _cards + entry->firstCard;
+    outConfig = LevelConfig(cards, entry->playFieldCount, cards + entry->playFieldCount, entry->stackCount);
+    return true;
+}
+
+bool LevelPack::write(const std::string& path, const std::vector<std::pair<int, const LevelConfig*>>& levels)
+{
+    std::vector<std::pair<int, const LevelConfig*>> sorted(levels);
+    std::sort(sorted.begin(), sorted.end(),
+        [](const std::pair<int, const LevelConfig*>& a, const std::pair<int, const LevelConfig*>& b) { return a.first < b.first; });
+
+    std::vector<LevelPackEntry> entries;
+    std::vector<LevelConfig::CardConfig> cards;
+    entries.reserve(sorted.size());
+    for (size_t i = 0; i < sorted.size(); i++) {
+        if (!sorted[i].second) return false;
+        if (i > 0 && sorted[i - 1].first == sorted[i].first) return false;
+
+        const LevelConfig& config = *sorted[i].second;
+        if (config.getPlayFieldCards().size() > 0xFFFF || config.getStackCards().size() > 0xFFFF) return false;
+
+        LevelPackEntry entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.levelId = sorted[i].first;
+        entry.firstCard = static_cast<uint32_t>(cards.size());
+        entry.playFieldCount = static_cast<uint16_t>(config.getPlayFieldCards().size());
+        entry.stackCount = static_cast<uint16_t>(config.getStackCards().size());
+        entries.push_back(entry);
+
+        cards.insert(cards.end(), config.getPlayFieldCards().begin(), config.getPlayFieldCards().end());
+        cards.insert(cards.end(), config.getStackCards().begin(), config.getStackCards().end());
+    }
+
+    for (const LevelConfig::CardConfig& card : cards) {
+        if (!isValidCard(card.face, card.suit)) return false;
+    }
+
+    LevelPackHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = VERSION;
+    header.cardRecordSize = sizeof(LevelConfig::CardConfig);
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.levelCount = static_cast<uint32_t>(entries.size());
+    header.cardCount = static_cast<uint32_t>(cards.size());
+    const uint32_t entriesEnd = static_cast<uint32_t>(sizeof(header) + entries.size() * sizeof(LevelPackEntry));
+    header.cardOffset = alignUp(entriesEnd, CARD_ALIGNMENT);
+
+    FILE* fp = std::fopen(path.c_str(), "wb");
+    if (!fp) return false;
+
+    static const uint8_t zeros[CARD_ALIGNMENT] = {};
+    bool ok = std::fwrite(&header, sizeof(header), 1, fp) == 1;
+    if (ok && !entries.empty()) ok = std::fwrite(entries.data(), sizeof(LevelPackEntry), entries.size(), fp) == entries.size();
+    if (ok && header.cardOffset > entriesEnd) ok = std::fwrite(zeros, 1, header.cardOffset - entriesEnd, fp) == header.cardOffset - entriesEnd;
+    if (ok && !cards.empty()) ok = std::fwrite(cards.data(), sizeof(LevelConfig::CardConfig), cards.size(), fp) == cards.size();
+
+    ok = (std::fclose(fp) == 0) && ok;
+    if (!ok) std::remove(path.c_str());
+    return ok;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#ifndef LEVEL_PACK_H
+#define LEVEL_PACK_H
+
+#include "../models/LevelConfig.h"
+#include "../../utils/MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * 二进制关卡包
+ * 由 tools/levelpack 离线把一批 level_N.json 编译成单个文件，运行时整体映射，
+ * 按关卡ID取出的 LevelConfig 直接指向映射内存，不解析、不拷贝。
+ *
+ * 文件布局（小端）：
+ *   [0, 32)            文件头 LevelPackHeader
+ *   [32, cardOffset)   levelCount 个 LevelPackEntry，按 levelId 升序
+ *   [cardOffset, ...)  cardCount 条 16 字节卡牌记录（即 LevelConfig::CardConfig），
+ *                      每关先桌面牌后牌堆，连续存放
+ */
+struct LevelPackHeader
+{
+    char magic[4];          // "LVPK"
+    uint16_t version;
+    uint16_t cardRecordSize; // sizeof(LevelConfig::CardConfig)
+    uint32_t byteOrder;      // 0x01020304，用于识别字节序不符的文件
+    uint32_t levelCount;
+    uint32_t cardCount;
+    uint32_t cardOffset;     // 卡牌记录起始偏移，16 字节对齐
+    uint32_t reserved[2];
+};
+
+struct LevelPackEntry
+{
+    int32_t levelId;
+    uint32_t firstCard;      // 本关第一条卡牌记录的下标
+    uint16_t playFieldCount;
+    uint16_t stackCount;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(LevelPackHeader) == 32, "LevelPackHeader must stay 32 bytes");
+static_assert(sizeof(LevelPackEntry) == 16, "LevelPackEntry must stay 16 bytes");
+static_assert(sizeof(LevelConfig::CardConfig) == 16, "CardConfig is stored verbatim in level packs");
+
+class LevelPack
+{
+public:
+    static const uint16_t VERSION = 1;
+    static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    LevelPack();
+    ~LevelPack() = default;
+
+    LevelPack(const LevelPack&) = delete;
+    LevelPack& operator=(const LevelPack&) = delete;
+
+    /**
+     * 映射关卡包文件
+     * @return 文件缺失或格式校验失败时返回 false
+     */
+    bool openFile(const std::string& path);
+
+    /**
+     * 接管一块已读入内存的关卡包（无法直接映射的平台，如 Android APK 内的资源）
+     */
+    bool openBuffer(std::vector<uint8_t>&& data);
+
+    void close();
+    bool isOpen() const { return _data != nullptr; }
+
+    int getLevelCount() const { return static_cast<int>(_header.levelCount); }
+
+    // 第 index 个关卡的ID（按ID升序）
+    int getLevelIdAt(int index) const;
+
+    bool hasLevel(int levelId) const { return findEntry(levelId) != nullptr; }
+
+    /**
+     * 取关卡配置视图，outConfig 指向关卡包内存，关卡包关闭后失效
+     * @return 关卡不存在时返回 false
+     */
+    bool getLevelConfig(int levelId, LevelConfig& outConfig) const;
+
+    /**
+     * 把一组关卡写成关卡包，levelId 可以不连续，写入时按ID排序
+     * @return 关卡ID重复、单关牌数超过 65535、含无效卡牌或写文件失败时返回 false
+     */
+    static bool write(const std::string& path, const std::vector<std::pair<int, const LevelConfig*>>& levels);
+
+private:
+    bool validate(const uint8_t* data, size_t size);
+    const LevelPackEntry* findEntry(int levelId) const;
+
+    MappedFile _file;
+    std::vector<uint8_t> _buffer;
+    const uint8_t* _data;
+    LevelPackHeader _header;
+    const LevelPackEntry* _entries;
+    const LevelConfig::CardConfig* _cards;
+};
+
+#endif // LEVEL_PACK_H
@@ -2,4 +2,59 @@
 
 LevelConfig::LevelConfig()
 {
-}
\ No newline at end of file
+}
+
+LevelConfig::LevelConfig(const CardConfig* playFieldCards, int playFieldCount,
+    const CardConfig* stackCards, int stackCount)
+    : _playFieldCards(playFieldCards, playFieldCount)
+    , _stackCards(stackCards, stackCount)
+{
+}
+
+LevelConfig::LevelConfig(const LevelConfig& other)
+{
+    *this = other;
+}
+
+LevelConfig& LevelConfig::operator=(const LevelConfig& other)
+{
+    if (this == &other) return *this;
+    _ownedPlayFieldCards = other._ownedPlayFieldCards;
+    _ownedStackCards = other._ownedStackCards;
+    // 自身持有的数据要指向拷贝后的存储，视图直接共享外部内存
+    _playFieldCards = other.ownsPlayFieldCards() ? makeList(_ownedPlayFieldCards) : other._playFieldCards;
+    _stackCards = other.ownsStackCards() ? makeList(_ownedStackCards) : other._stackCards;
+    return *this;
+}
+
+bool LevelConfig::isView() const
+{
+    return !ownsPlayFieldCards() || !ownsStackCards();
+}
+
+bool LevelConfig::ownsPlayFieldCards() const
+{
+    return _playFieldCards.empty() || _playFieldCards.begin() == _ownedPlayFieldCards.data();
+}
+
+bool LevelConfig::ownsStackCards() const
+{
+    return _stackCards.empty() || _stackCards.begin() == _ownedStackCards.data();
+}
+
+LevelConfig::CardList LevelConfig::makeList(const std::vector<CardConfig>& cards)
+{
+    return CardList(cards.data(), static_cast<int>(cards.size()));
+}
+
+void LevelConfig::setPlayFieldCards(const std::vector<CardConfig>& cards)
+{
+    _ownedPlayFieldCards = cards;
+    _playFieldCards = makeList(_ownedPlayFieldCards);
+}
+
+void LevelConfig::setStackCards(const std::vector<CardConfig>& cards)
+{
+    _ownedStackCards = cards;
+    _stackCards = makeList(_ownedStackCards);
+}
@@ -2,39 +2,75 @@
 #ifndef LEVEL_CONFIG_H
 #define LEVEL_CONFIG_H
 
-#include "cocos2d.h"
 #include "../../models/CardDefines.h"
 #include <vector>
 
 /**
  * ؿģ
  * 洢ؿľ̬
+ * ݼȿУJSON ༭Ҳֱָؿӳڴ棨ͼ
  */
 class LevelConfig
 {
 public:
-    // 
+    // 16 ֽڣؿеĿƼ¼ֽһ£
     struct CardConfig
     {
         CardFaceType face;      // Ƶ
         CardSuitType suit;      // ƻɫ
-        cocos2d::Vec2 position; // λ
+        CardPosition position;  // λ
+    };
+
+    // ֻ
+    class CardList
+    {
+    public:
+        CardList() : _data(nullptr), _count(0) {}
+        CardList(const CardConfig* data, int count) : _data(data), _count(count) {}
+
+        const CardConfig* begin() const { return _data; }
+        const CardConfig* end() const { return _data + _count; }
+        const CardConfig& operator[](int index) const { return _data[index]; }
+        int size() const { return _count; }
+        bool empty() const { return _count == 0; }
+
+    private:
+        const CardConfig* _data;
+        int _count;
     };
 
     LevelConfig();
+
+    /**
+     * ͼָⲿڴ棬ⲿڴȱþ
+     */
+    LevelConfig(const CardConfig* playFieldCards, int playFieldCount,
+        const CardConfig* stackCards, int stackCount);
+
+    LevelConfig(const LevelConfig& other);
+    LevelConfig& operator=(const LevelConfig& other);
     ~LevelConfig() = default;
 
     // ȡĿ
-    const std::vector<CardConfig>& getPlayFieldCards() const { return _playFieldCards; }
-    void setPlayFieldCards(const std::vector<CardConfig>& cards) { _playFieldCards = cards; }
+    CardList getPlayFieldCards() const { return _playFieldCards; }
+    void setPlayFieldCards(const std::vector<CardConfig>& cards);
 
     // ȡñĿ
-    const std::vector<CardConfig>& getStackCards() const { return _stackCards; }
-    void setStackCards(const std::vector<CardConfig>& cards) { _stackCards = cards; }
+    CardList getStackCards() const { return _stackCards; }
+    void setStackCards(const std::vector<CardConfig>& cards);
+
+    // Ƿָⲿڴ
+    bool isView() const;
 
 private:
-    std::vector<CardConfig> _playFieldCards; // 
-    std::vector<CardConfig> _stackCards;     // 
+    bool ownsPlayFieldCards() const;
+    bool ownsStackCards() const;
+    static CardList makeList(const std::vector<CardConfig>& cards);
+
+    CardList _playFieldCards; // 
+    CardList _stackCards;     // 
+    std::vector<CardConfig> _ownedPlayFieldCards; // ʱĴ洢
+    std::vector<CardConfig> _ownedStackCards;
 };
 
-#endif // LEVEL_CONFIG_H
\ No newline at end of file
+#endif // LEVEL_CONFIG_H
@@ -1,70 +1,89 @@
 #include "GameController.h"
 #include "../configs/loaders/LevelConfigLoader.h"
-#include "../services/GameModelGenerator.h"
-#include "../utils/GameUtils.h"
+#include "../utils/EventLog.h"
+#include "../utils/Trace.h"
 
 USING_NS_CC;
 
-GameController::GameController() {
-    _undoManager = new UndoManager();
+namespace {
+    const float MATCH_TRANSITION_DURATION = 0.5f; // 桌面牌飞向底牌区
+    const float DRAW_TRANSITION_DURATION = 0.4f; // 抽到的牌从抽牌区飞向底牌区
+}
+
+GameController::GameController()
+    : _seedSource(RandomService::makeEntropySeed())
+    , _transitions(TRANSITION_QUEUE_CAPACITY) {
+    _engine = new GameEngine();
+    // 提示结果经调度器回到 cocos 线程，缓存与回调只在主线程访问
+    _hintService = new HintService([](const std::function<void()>& task) {
+        Director::getInstance()->getScheduler()->performFunctionInCocosThread(task);
+    });
     _configLoader = new LevelConfigLoader();
-    _modelGenerator = new GameModelGenerator();
 }
 
 GameController::~GameController() {
-    delete _gameModel;
     delete _gameView;
-    delete _undoManager;
+    delete _hintService; // 先于引擎销毁：等待工作线程退出
+    delete _engine;
     delete _configLoader;
-    delete _modelGenerator;
+}
+
+GameModel* GameController::getGameModel() const {
+    return _engine->getGameModel();
 }
 
 void GameController::startGame(int levelId) {
-    _gameModel = _modelGenerator->generateRandomGameModel();
-    if (!_gameModel) return;
+    _engine->newRandomGame(_seedSource.next(), _shoeSize);
+    EVENT_LOG(CONTROLLER_DEAL, _engine->getDealSeed());
+    createGameView();
+}
 
+void GameController::startPreparedGame(GameEngine* engine) {
+    if (!engine) return;
+    delete _engine;
+    _engine = engine;
+    EVENT_LOG(CONTROLLER_DEAL, _engine->getDealSeed());
+    createGameView();
+}
+
+void GameController::createGameView() {
     _gameView = GameView::create();
     if (!_gameView) return;
 
     _gameView->setCardClickCallback([this](int cardId) { handleCardClick(cardId); });
     _gameView->setDrawAreaClickCallback([this]() { handleDrawCard(); });
+    _gameView->setCardTransitionFinishedCallback([this]() { playNextTransition(); });
 
-    _gameView->updateView(_gameModel);
-    _undoManager->init();
-    _gameModel->setScore(0);
+    GameModel* gameModel = _engine->getGameModel();
+    _gameView->updateView(gameModel);
 
-    if (_stackCountCallback) _stackCountCallback(_gameModel->getStackRemaining());
+    if (_stackCountCallback) _stackCountCallback(gameModel->getStackRemaining());
     if (_comboCallback) _comboCallback(0);
+    onModelCommitted();
 }
 
 void GameController::restartGame() {
-    delete _gameModel;
-    _gameModel = nullptr;
+    // 原地重新发牌：旧局卡牌随对象池一次性回收，不再逐张 delete/new
     // 重建 view 不重建，由 scene 管理
-    _gameModel = _modelGenerator->generateRandomGameModel();
-    if (!_gameModel) return;
-    _undoManager->init();
-    _gameModel->setScore(0);
-    _gameView->updateView(_gameModel);
-    if (_stackCountCallback) _stackCountCallback(_gameModel->getStackRemaining());
+    _engine->newRandomGame(_seedSource.next(), _shoeSize);
+    GameModel* gameModel = _engine->getGameModel();
+    flushTransitions();
+    _gameView->updateView(gameModel);
+    if (_stackCountCallback) _stackCountCallback(gameModel->getStackRemaining());
     if (_comboCallback) _comboCallback(0);
-    CCLOG("GameController: Game restarted");
+    _hintService->clearCache();
+    onModelCommitted();
+    EVENT_LOG(CONTROLLER_RESTART, _engine->getDealSeed());
 }
 
 bool GameController::hasAnyMatch() const {
-    if (!_gameModel) return false;
-    CardModel* bc = _gameModel->getBottomCard();
-    if (!bc) return false;
-    for (auto& pf : _gameModel->getPlayFieldCards()) {
-        if (pf && checkCardsMatch(pf, bc)) return true;
-    }
-    return false;
+    return _engine->hasAnyMatch();
 }
 
 void GameController::checkGameEnd() {
-    if (!_gameModel || !_gameEndCallback) return;
+    if (!_gameEndCallback) return;
 
-    if (_gameModel->getStackCards().empty() && !hasAnyMatch()) {
+    if (_engine->isGameOver()) {
         // 栈空且无匹配 → 胜利
         _gameEndCallback(true);
     }
@@ -72,161 +91,142 @@ void GameController::checkGameEnd() {
 
 bool GameController::handleCardClick(int cardId)
 {
-    if (!_gameModel || !_gameView) return false;
-
-    CardModel* clickedCard = _gameModel->getCardById(cardId);
-    CardModel* bottomCard = _gameModel->getBottomCard();
-    if (!clickedCard || !bottomCard) return false;
-
-    if (checkCardsMatch(clickedCard, bottomCard)) {
-        cocos2d::Vec2 pos = clickedCard->getPosition();
-
-        UndoModel* undoModel = new UndoModel();
-        undoModel->setOperationType(OperationType::CARD_MATCH);
-        undoModel->setMatchedCardId(clickedCard->getCardId());
-        undoModel->setPreviousBottomCardId(bottomCard->getCardId());
-        undoModel->setMatchedCardPosition(pos);
-        undoModel->setPreviousBottomPosition(Vec2::ZERO);
-        _undoManager->pushUndoRecord(undoModel);
-
-        // 连击加分：combo 0→+1, combo 1→+2, combo 2→+3...
-        _gameModel->addCombo();
-        int combo = _gameModel->getCombo();
-        int addPoints = 1 + combo;
-        _gameModel->addScore(addPoints);
-        CCLOG("GameController: Combo x%d! Score +%d, total: %d", combo + 1, addPoints, _gameModel->getScore());
-
-        if (_scoreCallback) _scoreCallback(addPoints);
-        if (_comboCallback) _comboCallback(combo + 1);
-
-        _gameModel->removeCardFromPlayField(clickedCard->getCardId());
-
-        auto bottomWorld = _gameView->getBottomNode()->convertToWorldSpace(Vec2::ZERO);
-        auto pfNode = _gameView->getPlayFieldNode();
-        auto target = pfNode->convertToNodeSpace(bottomWorld);
-
-        _gameView->playCardMoveAnimation(clickedCard->getCardId(), target, 0.5f,
-            [this, clickedCard, bottomCard, pos]() {
-                if (bottomCard) {
-                    auto sc = _gameModel->getStackCards();
-                    sc.insert(sc.begin(), bottomCard);
-                    _gameModel->setStackCards(sc);
-                }
-                clickedCard->setPosition(Vec2::ZERO);
-                _gameModel->setBottomCard(clickedCard);
-
-                if (!_gameModel->getStackCards().empty()) {
-                    _gameModel->drawCardFromStackToPlayField(pos);
-                }
-
-                if (_stackCountCallback) _stackCountCallback(_gameModel->getStackRemaining());
-                _gameView->updateView(_gameModel);
-                checkGameEnd();
-            });
-        return true;
-    }
-    return false;
+    TRACE_SCOPE_VALUE("GameController::handleCardClick", cardId);
+    if (!_gameView) return false;
+
+    // 模型由引擎同步提交，动画只负责视觉过渡
+    MoveResult result = _engine->applyMatch(cardId);
+    if (!result.applied) return false;
+
+    if (_scoreCallback) _scoreCallback(result.scoreDelta);
+    if (_comboCallback) _comboCallback(result.combo + 1);
+
+    // 起点取刷新前的桌面位置，刷新后被点击的牌已挂到底牌区，补位牌立即可点
+    Vec2 from = _gameView->getPlayFieldWorldPosition(result.slotPosition);
+    GameModel* gameModel = _engine->getGameModel();
+    if (_stackCountCallback) _stackCountCallback(gameModel->getStackRemaining());
+    _gameView->updateView(gameModel);
+    onModelCommitted();
+    enqueueTransition(MoveType::MATCH, result.cardId, from);
+    return true;
 }
 
 void GameController::handleDrawCard()
 {
-    if (!_gameModel || !_gameView) return;
-    if (_gameModel->getStackCards().empty()) return;
+    TRACE_SCOPE("GameController::handleDrawCard");
+    if (!_gameView) return;
 
-    CardModel* prevBottom = _gameModel->getBottomCard();
-    CardModel* drawnCard = _gameModel->drawCardFromStack();
-    if (!drawnCard) return;
+    MoveResult result = _engine->applyDraw();
+    if (!result.applied) return;
 
     // 断连：DRAW操作会重置连击
-    _gameModel->resetCombo();
     if (_comboCallback) _comboCallback(0);
 
     // 罚分判定
-    if (prevBottom && hasAnyMatch()) {
-        _gameModel->addScore(-2);
-        CCLOG("GameController: DRAW penalty -2, total: %d", _gameModel->getScore());
-        if (_scoreCallback) _scoreCallback(-2);
-    }
+    if (result.penalized && _scoreCallback) _scoreCallback(result.scoreDelta);
+
+    // 牌堆中的牌没有视图，抽到的牌在底牌位新建后从抽牌区飞入
+    GameModel* gameModel = _engine->getGameModel();
+    if (_stackCountCallback) _stackCountCallback(gameModel->getStackRemaining());
+    _gameView->updateView(gameModel);
+    onModelCommitted();
+    enqueueTransition(MoveType::DRAW, result.cardId, _gameView->getDrawAreaWorldPosition());
+}
 
-    UndoModel* um = new UndoModel();
-    um->setOperationType(OperationType::DRAW_CARD);
-    if (prevBottom) um->setPreviousBottomCardId(prevBottom->getCardId());
-    um->setNewBottomCardId(drawnCard->getCardId());
-    _undoManager->pushUndoRecord(um);
+void GameController::handleUndo() {
+    TRACE_SCOPE("GameController::handleUndo");
+    if (!_gameView || !_engine->canUndo()) return;
+    int previousScore = _engine->getGameModel()->getScore();
+    if (!_engine->undo()) return;
+    onTimelineMoved(previousScore);
+}
 
-    auto drawWorld = _gameView->getDrawAreaNode()->convertToWorldSpace(Vec2::ZERO);
-    auto daNode = _gameView->getDrawAreaNode();
-    auto targetDA = daNode->convertToNodeSpace(drawWorld);
+void GameController::handleRedo() {
+    TRACE_SCOPE("GameController::handleRedo");
+    if (!_gameView || !_engine->canRedo()) return;
+    int previousScore = _engine->getGameModel()->getScore();
+    if (!_engine->redo()) return;
+    onTimelineMoved(previousScore);
+}
 
-    _gameView->playCardMoveAnimation(drawnCard->getCardId(), targetDA, 0.4f,
-        [this, drawnCard, prevBottom]() {
-            if (prevBottom) {
-                auto sc = _gameModel->getStackCards();
-                sc.insert(sc.begin(), prevBottom);
-                _gameModel->setStackCards(sc);
-            }
-            drawnCard->setPosition(Vec2::ZERO);
-            _gameModel->setBottomCard(drawnCard);
+bool GameController::seekToMove(int moveIndex) {
+    if (!_gameView) return false;
+    int previousScore = _engine->getGameModel()->getScore();
+    if (!_engine->seekToMove(moveIndex)) return false;
+    onTimelineMoved(previousScore);
+    return true;
+}
+
+void GameController::onTimelineMoved(int previousScore) {
+    GameModel* gameModel = _engine->getGameModel();
 
-            if (_stackCountCallback) _stackCountCallback(_gameModel->getStackRemaining());
-            _gameView->updateView(_gameModel);
-        });
+    // 撤销、重做与跳转同时改变得分与连击
+    int scoreDelta = gameModel->getScore() - previousScore;
+    if (scoreDelta != 0 && _scoreCallback) _scoreCallback(scoreDelta);
+    int combo = gameModel->getCombo();
+    if (_comboCallback) _comboCallback(combo > 0 ? combo + 1 : 0);
+
+    if (_stackCountCallback) _stackCountCallback(gameModel->getStackRemaining());
+    flushTransitions();
+    _gameView->updateView(gameModel);
+    onModelCommitted();
 }
 
-void GameController::handleUndo() {
-    if (!_gameModel || !_gameView || !_undoManager->canUndo()) return;
-
-    UndoModel* undoModel = _undoManager->popUndoRecord();
-    if (!undoModel) return;
-
-    switch (undoModel->getOperationType()) {
-    case OperationType::CARD_MATCH:
-    {
-        CardModel* mc = _gameModel->getCardById(undoModel->getMatchedCardId());
-        CardModel* pb = _gameModel->getCardById(undoModel->getPreviousBottomCardId());
-        if (mc && pb) {
-            mc->setPosition(undoModel->getMatchedCardPosition());
-            auto pfc = _gameModel->getPlayFieldCards();
-            pfc.push_back(mc);
-            _gameModel->setPlayFieldCards(pfc);
-
-            pb->setPosition(Vec2::ZERO);
-            _gameModel->setBottomCard(pb);
-
-            auto sc = _gameModel->getStackCards();
-            if (!sc.empty() && sc.front()->getCardId() == pb->getCardId()) {
-                sc.erase(sc.begin());
-                _gameModel->setStackCards(sc);
-            }
-            if (_stackCountCallback) _stackCountCallback(_gameModel->getStackRemaining());
-            _gameView->updateView(_gameModel);
-        }
-        break;
-    }
-    case OperationType::DRAW_CARD:
-    {
-        CardModel* nb = _gameModel->getCardById(undoModel->getNewBottomCardId());
-        CardModel* pb = _gameModel->getCardById(undoModel->getPreviousBottomCardId());
-        if (nb && pb) {
-            nb->setFlipped(false);
-            auto sc = _gameModel->getStackCards();
-            sc.push_back(nb);
-            _gameModel->setStackCards(sc);
-
-            pb->setPosition(undoModel->getPreviousBottomPosition());
-            pb->setFlipped(true);
-            _gameModel->setBottomCard(pb);
-            if (_stackCountCallback) _stackCountCallback(_gameModel->getStackRemaining());
-            _gameView->updateView(_gameModel);
-        }
-        break;
+bool GameController::getHint(Hint& outHint) const {
+    return _hintService->getHint(outHint);
+}
+
+void GameController::setHintReadyCallback(const std::function<void(const Hint&)>& cb) {
+    _hintService->setHintReadyCallback(cb);
+}
+
+void GameController::onModelCommitted() {
+    if (_modelCommittedCallback) _modelCommittedCallback();
+    requestHint();
+}
+
+void GameController::requestHint() {
+    _hintService->onStateChanged(_engine->getGameModel());
+}
+
+void GameController::enqueueTransition(MoveType type, int cardId, const Vec2& fromWorld)
+{
+    ViewTransition transition = { type, cardId, fromWorld.x, fromWorld.y };
+    // 队列满时覆盖最旧的过渡：它们的结果早已体现在视图上
+    _transitions.pushBack(transition);
+
+    if (_gameView->isCardTransitionPlaying()) {
+        // 玩家快于动画：当前过渡直接跳到终点，完成回调会接着播放队列
+        _gameView->finishCardTransition();
+    } else {
+        playNextTransition();
     }
-    default: break;
+}
+
+void GameController::playNextTransition()
+{
+    TRACE_SCOPE("GameController::playNextTransition");
+    // 积压多个时只保留最新一个，中间的过渡合并掉
+    while (_transitions.size() > 1) _transitions.popFront();
+
+    while (!_transitions.empty()) {
+        ViewTransition transition = _transitions.front();
+        _transitions.popFront();
+
+        // 只有仍是底牌的牌才需要过渡，已被后续操作顶走的直接跳过
+        CardModel* bottomCard = _engine->getGameModel()->getBottomCard();
+        if (!bottomCard || bottomCard->getCardId() != transition.cardId) continue;
+
+        float duration = transition.type == MoveType::MATCH ? MATCH_TRANSITION_DURATION : DRAW_TRANSITION_DURATION;
+        if (_gameView->playCardTransition(transition.cardId, Vec2(transition.fromX, transition.fromY), duration)) return;
     }
-    delete undoModel;
+
+    // 队列播完，视图与模型一致
+    checkGameEnd();
 }
 
-bool GameController::checkCardsMatch(const CardModel* c1, const CardModel* c2) const {
-    if (!c1 || !c2) return false;
-    return GameUtils::isCardsMatch(c1->getFaceValue(), c2->getFaceValue());
+void GameController::flushTransitions()
+{
+    _transitions.clear();
+    _gameView->cancelCardTransition();
 }
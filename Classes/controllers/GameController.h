@@ -2,13 +2,20 @@
 #define GAME_CONTROLLER_H
 
 #include "cocos2d.h"
-#include "../models/GameModel.h"
+#include "../core/GameEngine.h"
 #include "../views/GameView.h"
-#include "../managers/UndoManager.h"
+#include "../services/HintService.h"
+#include "../utils/RingBuffer.h"
 
 class LevelConfigLoader;
-class GameModelGenerator;
 
+/**
+ * 游戏控制器
+ * 包装无引擎依赖的 GameEngine：把输入转成引擎操作，再驱动 GameView 播放过渡与刷新
+ * 每次点击都立即同步提交到模型并刷新视图（点击索引随之更新），动画期间的点击不会丢失；
+ * 视觉过渡进入定容队列异步回放，玩家操作快于动画时跳过积压的过渡，只播最新一个。
+ * 每次提交后提示服务即在后台为新牌面搜索下一步，按下提示时直接取结果。
+ */
 class GameController
 {
 public:
@@ -16,36 +23,89 @@ public:
     ~GameController();
 
     void startGame(int levelId);
+    // 以已发好牌的引擎开局（启动时在后台线程发第一局），接管 engine 的所有权
+    void startPreparedGame(GameEngine* engine);
     void restartGame();
     bool handleCardClick(int cardId);
     void handleDrawCard();
     void handleUndo();
+    void handleRedo();
+
+    // 跳到本局第 moveIndex 步之后的牌面（0 为开局），供回放与排查使用
+    bool seekToMove(int moveIndex);
+
+    /**
+     * 当前牌面的提示：建议点击的桌面牌或抽牌
+     * @return 后台搜索尚未完成时返回 false，完成后经提示就绪回调通知
+     */
+    bool getHint(Hint& outHint) const;
 
     cocos2d::Node* getGameView() const { return _gameView; }
-    GameModel* getGameModel() const { return _gameModel; }
+    GameModel* getGameModel() const;
+    GameEngine* getGameEngine() const { return _engine; }
 
     void setScoreCallback(const std::function<void(int)>& cb) { _scoreCallback = cb; }
     void setComboCallback(const std::function<void(int)>& cb) { _comboCallback = cb; }
     void setGameEndCallback(const std::function<void(bool)>& cb) { _gameEndCallback = cb; }
     void setStackCountCallback(const std::function<void(int)>& cb) { _stackCountCallback = cb; }
+    // 当前牌面的提示算好时在主线程回调
+    void setHintReadyCallback(const std::function<void(const Hint&)>& cb);
+    // 每次模型提交（发牌、点击、抽牌、撤销、重做、跳转）且视图刷新后回调，供性能浮层标记帧
+    void setModelCommittedCallback(const std::function<void()>& cb) { _modelCommittedCallback = cb; }
+
+    // 每局总牌数，下一次 startGame/restartGame 生效（GameModelGenerator::HUGE_SHOE_CARDS 为超大牌靴模式）
+    void setShoeSize(int totalCards) { _shoeSize = totalCards; }
+    int getShoeSize() const { return _shoeSize; }
 
     // 检查是否有可匹配牌
     bool hasAnyMatch() const;
 
 private:
-    bool checkCardsMatch(const CardModel* c1, const CardModel* c2) const;
+    // 排队等待播放的视觉过渡（POD，队列定容，入队出队不分配内存）
+    struct ViewTransition
+    {
+        MoveType type;
+        int cardId;   // 过渡的牌，即操作后的底牌
+        float fromX;  // 过渡起点（世界坐标）
+        float fromY;
+    };
+
+    static const int TRANSITION_QUEUE_CAPACITY = 16;
+
     void checkGameEnd();
 
-    GameModel* _gameModel = nullptr;
+    // 开局：创建视图并按引擎当前牌面刷新
+    void createGameView();
+
+    // 撤销、重做或跳转之后：通知界面并让视图直接停在新牌面
+    void onTimelineMoved(int previousScore);
+
+    // 模型已提交、视图已刷新后调用：排入过渡并在空闲时开始播放
+    void enqueueTransition(MoveType type, int cardId, const cocos2d::Vec2& fromWorld);
+    // 播放队列中下一个仍然有效的过渡，队列播完后检查结局
+    void playNextTransition();
+    // 丢弃所有未播放的过渡并让视图直接停在模型状态（撤销、重开）
+    void flushTransitions();
+
+    // 模型提交、视图刷新后调用：通知模型提交回调，并请求提示
+    void onModelCommitted();
+
+    // 通知提示服务，取消过时的搜索并为新牌面开始搜索
+    void requestHint();
+
+    GameEngine* _engine = nullptr;
+    HintService* _hintService = nullptr;
     GameView* _gameView = nullptr;
-    UndoManager* _undoManager = nullptr;
     LevelConfigLoader* _configLoader = nullptr;
-    GameModelGenerator* _modelGenerator = nullptr;
+    RandomService _seedSource; // 只用于挑选每局的种子，发牌本身由种子决定
+    int _shoeSize = GameModelGenerator::DEFAULT_TOTAL_CARDS;
+    RingBuffer<ViewTransition> _transitions;
 
     std::function<void(int)> _scoreCallback;
     std::function<void(int)> _comboCallback;
     std::function<void(bool)> _gameEndCallback;
     std::function<void(int)> _stackCountCallback;
+    std::function<void()> _modelCommittedCallback;
 };
 
 #endif
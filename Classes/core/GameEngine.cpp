@@ -0,0 +1,319 @@
+#include "GameEngine.h"
+#include "../services/MatchRules.h"
+#include "../utils/EventLog.h"
+#include "../utils/Trace.h"
+
+namespace {
+    uint16_t packCardId(const CardModel* card)
+    {
+        return card ? static_cast<uint16_t>(card->getCardId()) : UndoModel::NO_CARD;
+    }
+
+    int unpackCardId(uint16_t cardId)
+    {
+        return cardId == UndoModel::NO_CARD ? -1 : cardId;
+    }
+}
+
+GameEngine::GameEngine()
+    : _gameModel(new GameModel())
+    , _replayMove(nullptr)
+    , _dealSeed(0)
+{
+}
+
+GameEngine::~GameEngine()
+{
+    delete _gameModel;
+}
+
+void GameEngine::newRandomGame(uint64_t seed, int totalCards)
+{
+    _dealSeed = seed;
+    _modelGenerator.generateRandomGameModel(_gameModel, seed, totalCards);
+    _undoManager.init();
+    _timeline.init(_gameModel);
+}
+
+bool GameEngine::newDealGame(const DealLibrary& library, uint64_t index)
+{
+    const uint8_t* cards = library.getDealCards(index);
+    if (!cards) return false;
+    _dealSeed = library.getDealSeed(index);
+    _modelGenerator.generateGameModelFromDeal(_gameModel, cards, library.getCardsPerDeal());
+    _undoManager.init();
+    _timeline.init(_gameModel);
+    return true;
+}
+
+bool GameEngine::newLevelGame(LevelConfig* levelConfig)
+{
+    if (!levelConfig) return false;
+    _dealSeed = 0;
+    _modelGenerator.generateGameModel(levelConfig, _gameModel);
+    _undoManager.init();
+    _timeline.init(_gameModel);
+    return true;
+}
+
+MoveResult GameEngine::applyMove(MoveType type, int cardId)
+{
+    return type == MoveType::MATCH ? applyMatch(cardId) : applyDraw();
+}
+
+bool GameEngine::canMatch(int cardId) const
+{
+    CardModel* card = _gameModel->getCardById(cardId);
+    CardModel* bottomCard = _gameModel->getBottomCard();
+    if (!card || !bottomCard) return false;
+    // 卡牌表包含本局全部卡牌，只有桌面上的牌可以匹配
+    if (card->getArea() != GameAreaType::PLAY_FIELD) return false;
+    return GameMatchTable::canMatch(card->getKindIndex(), bottomCard->getKindIndex());
+}
+
+MoveResult GameEngine::applyMatch(int cardId)
+{
+    TRACE_SCOPE("GameEngine::applyMatch");
+    MoveResult result;
+    result.type = MoveType::MATCH;
+    if (!canMatch(cardId)) return result;
+
+    CardModel* clickedCard = _gameModel->getCardById(cardId);
+    CardModel* bottomCard = _gameModel->getBottomCard();
+    CardPosition slot = clickedCard->getPosition();
+
+    // 连击加分：默认规则下第 1 次匹配 +2，第 2 次 +3...
+    _gameModel->addCombo();
+    int addPoints = _replayMove ? _replayMove->scoreDelta : _scoringRules.matchScore(_gameModel->getCombo());
+    _gameModel->addScore(addPoints);
+
+    // 被点击的牌成为底牌，旧底牌放回牌堆底，再从牌堆顶补一张到空位
+    _gameModel->removeCardFromPlayField(cardId);
+    _gameModel->pushCardToStackBottom(bottomCard);
+    clickedCard->setPosition(CardPosition());
+    _gameModel->setBottomCard(clickedCard);
+    CardModel* refill = _gameModel->drawCardFromStackToPlayField(slot);
+
+    UndoModel record = {};
+    record.operationType = OperationType::CARD_MATCH;
+    record.cardId = packCardId(clickedCard);
+    record.previousBottomId = packCardId(bottomCard);
+    record.refillCardId = packCardId(refill);
+    record.scoreDelta = addPoints;
+    record.comboDelta = 1;
+    _undoManager.pushUndoRecord(record);
+    onMoveApplied(OperationType::CARD_MATCH, cardId, addPoints);
+
+    result.applied = true;
+    result.cardId = cardId;
+    result.previousBottomId = bottomCard->getCardId();
+    result.refillCardId = refill ? refill->getCardId() : -1;
+    result.slotPosition = slot;
+    result.scoreDelta = addPoints;
+    result.combo = _gameModel->getCombo();
+    EVENT_LOG(ENGINE_MATCH, result.combo + 1, addPoints, _gameModel->getScore());
+    return result;
+}
+
+MoveResult GameEngine::applyDraw()
+{
+    TRACE_SCOPE("GameEngine::applyDraw");
+    MoveResult result;
+    result.type = MoveType::DRAW;
+    if (_gameModel->getStackCards().empty()) return result;
+
+    CardModel* prevBottom = _gameModel->getBottomCard();
+    int previousCombo = _gameModel->getCombo();
+
+    // 罚分判定：桌面仍有可匹配牌却选择抽牌
+    if (prevBottom && _gameModel->hasMatchForBottom()) {
+        int penalty = _replayMove ? _replayMove->scoreDelta : _scoringRules.drawPenalty;
+        _gameModel->addScore(penalty);
+        result.scoreDelta = penalty;
+        result.penalized = true;
+        EVENT_LOG(ENGINE_DRAW_PENALTY, penalty, _gameModel->getScore());
+    }
+
+    // 断连：DRAW操作会重置连击
+    _gameModel->resetCombo();
+
+    CardModel* drawnCard = _gameModel->drawCardFromStack();
+    _gameModel->pushCardToStackBottom(prevBottom);
+    drawnCard->setPosition(CardPosition());
+    drawnCard->setFlipped(true);
+    _gameModel->setBottomCard(drawnCard);
+
+    UndoModel record = {};
+    record.operationType = OperationType::DRAW_CARD;
+    record.cardId = packCardId(drawnCard);
+    record.previousBottomId = packCardId(prevBottom);
+    record.refillCardId = UndoModel::NO_CARD;
+    record.scoreDelta = result.scoreDelta;
+    record.comboDelta = -previousCombo;
+    _undoManager.pushUndoRecord(record);
+    onMoveApplied(OperationType::DRAW_CARD, drawnCard->getCardId(), result.scoreDelta);
+
+    result.applied = true;
+    result.cardId = drawnCard->getCardId();
+    result.previousBottomId = prevBottom ? prevBottom->getCardId() : -1;
+    result.combo = 0;
+    return result;
+}
+
+bool GameEngine::canUndo() const
+{
+    return _undoManager.getDepth() > 0 && _timeline.getCursor() > 0;
+}
+
+void GameEngine::setUndoDepth(int depth)
+{
+    _undoManager.setDepth(depth);
+}
+
+int GameEngine::getUndoDepth() const
+{
+    return _undoManager.getDepth();
+}
+
+bool GameEngine::undo()
+{
+    TRACE_SCOPE("GameEngine::undo");
+    if (!canUndo()) return false;
+    int cursor = _timeline.getCursor();
+
+    UndoModel record;
+    if (!_undoManager.popUndoRecord(record)) {
+        // 撤销记录已被环形缓冲覆盖：从检查点重建上一步
+        return seekToMove(cursor - 1);
+    }
+    _timeline.setCursor(cursor - 1);
+
+    switch (record.operationType) {
+    case OperationType::CARD_MATCH:
+        undoMatch(record);
+        break;
+    case OperationType::DRAW_CARD:
+        undoDraw(record);
+        break;
+    default:
+        break;
+    }
+
+    // 得分与连击按记录的变化量回退
+    _gameModel->addScore(-record.scoreDelta);
+    _gameModel->setCombo(_gameModel->getCombo() - record.comboDelta);
+    return true;
+}
+
+bool GameEngine::canRedo() const
+{
+    return _timeline.getCursor() < _timeline.getMoveCount();
+}
+
+bool GameEngine::redo()
+{
+    if (!canRedo()) return false;
+    return replayMove(_timeline.getMove(_timeline.getCursor()));
+}
+
+bool GameEngine::seekToMove(int moveIndex)
+{
+    if (moveIndex < 0 || moveIndex > _timeline.getMoveCount()) return false;
+
+    int cursor = _timeline.getCursor();
+    if (moveIndex == cursor) return true;
+    if (moveIndex == cursor - 1 && _undoManager.canUndo()) return undo();
+
+    // 目标与当前位置在同一检查点区间内且在前方时直接重放，否则从检查点重建
+    const GameSnapshot* checkpoint = _timeline.findCheckpoint(moveIndex);
+    if (!checkpoint) return false;
+    if (moveIndex < cursor || checkpoint->moveIndex > cursor) {
+        _timeline.restore(*checkpoint, _gameModel);
+        _undoManager.clear();
+        _timeline.setCursor(checkpoint->moveIndex);
+    }
+
+    while (_timeline.getCursor() < moveIndex) {
+        if (!replayMove(_timeline.getMove(_timeline.getCursor()))) return false;
+    }
+    return true;
+}
+
+void GameEngine::onMoveApplied(OperationType type, int cardId, int scoreDelta)
+{
+    if (_replayMove) {
+        _timeline.setCursor(_timeline.getCursor() + 1);
+        return;
+    }
+    MoveRecord move = {};
+    move.operationType = type;
+    move.cardId = static_cast<uint16_t>(cardId);
+    move.scoreDelta = scoreDelta;
+    _timeline.recordMove(move, _gameModel);
+}
+
+bool GameEngine::replayMove(const MoveRecord& move)
+{
+    _replayMove = &move;
+    MoveResult result = move.operationType == OperationType::CARD_MATCH ? applyMatch(move.cardId) : applyDraw();
+    _replayMove = nullptr;
+    return result.applied;
+}
+
+void GameEngine::undoMatch(const UndoModel& record)
+{
+    CardModel* mc = _gameModel->getCardById(unpackCardId(record.cardId));
+    CardModel* pb = _gameModel->getCardById(unpackCardId(record.previousBottomId));
+    if (!mc || !pb) return;
+
+    // 补位牌放回牌堆顶，它占据的正是被点击牌原来的位置
+    CardPosition slot;
+    CardModel* refill = _gameModel->getCardById(unpackCardId(record.refillCardId));
+    if (refill && _gameModel->removeCardFromPlayField(refill->getCardId())) {
+        slot = refill->getPosition();
+        refill->setFlipped(false);
+        _gameModel->pushCardToStackTop(refill);
+    }
+
+    // 旧底牌从牌堆底取回
+    const CardDeck& stack = _gameModel->getStackCards();
+    if (!stack.empty() && stack.front() == pb) {
+        _gameModel->popCardFromStackBottom();
+    }
+
+    mc->setPosition(slot);
+    _gameModel->addCardToPlayField(mc);
+
+    pb->setPosition(CardPosition());
+    _gameModel->setBottomCard(pb);
+}
+
+void GameEngine::undoDraw(const UndoModel& record)
+{
+    CardModel* nb = _gameModel->getCardById(unpackCardId(record.cardId));
+    CardModel* pb = _gameModel->getCardById(unpackCardId(record.previousBottomId));
+    if (!nb || !pb) return;
+
+    nb->setFlipped(false);
+    _gameModel->pushCardToStackTop(nb);
+
+    // 抽牌时旧底牌被放回了牌堆底，撤销时一并取回
+    const CardDeck& stack = _gameModel->getStackCards();
+    if (!stack.empty() && stack.front() == pb) {
+        _gameModel->popCardFromStackBottom();
+    }
+
+    pb->setPosition(CardPosition());
+    pb->setFlipped(true);
+    _gameModel->setBottomCard(pb);
+}
+
+bool GameEngine::hasAnyMatch() const
+{
+    return _gameModel->hasMatchForBottom();
+}
+
+bool GameEngine::isGameOver() const
+{
+    return _gameModel->getStackCards().empty() && !hasAnyMatch();
+}
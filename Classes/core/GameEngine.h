@@ -0,0 +1,162 @@
+#pragma once
+#ifndef GAME_ENGINE_H
+#define GAME_ENGINE_H
+
+#include "../models/GameModel.h"
+#include "../managers/UndoManager.h"
+#include "../managers/TimelineManager.h"
+#include "../services/GameModelGenerator.h"
+#include "../services/DealLibrary.h"
+
+/**
+ * 操作类型
+ */
+enum class MoveType
+{
+    MATCH, // 点击桌面牌与底牌匹配
+    DRAW   // 从牌堆抽牌替换底牌
+};
+
+/**
+ * 计分规则
+ * 第 n 次连续匹配（n 从 1 起）得 matchBaseScore + comboBonus * min(n, comboCap)，
+ * 桌面仍有可匹配牌时抽牌得 drawPenalty 并断连。默认值即线上规则。
+ */
+struct ScoringRules
+{
+    int matchBaseScore = 1; // 匹配基础分
+    int comboBonus = 1;     // 每级连击的加分
+    int comboCap = 0;       // 连击加分封顶的级数，0 表示不封顶
+    int drawPenalty = -2;   // 有可匹配牌时抽牌的罚分
+
+    // 本次匹配后连击数为 combo 时的得分
+    int matchScore(int combo) const
+    {
+        return matchBaseScore + comboBonus * (comboCap > 0 && combo > comboCap ? comboCap : combo);
+    }
+};
+
+/**
+ * 一次操作的结果
+ * applyMove 返回时模型已经完成全部修改，视图据此播放过渡动画
+ */
+struct MoveResult
+{
+    bool applied = false;         // 操作是否合法并已执行
+    MoveType type = MoveType::MATCH;
+    int cardId = -1;              // 匹配时为被点击的桌面牌，抽牌时为抽到的牌；执行后即新底牌
+    int previousBottomId = -1;    // 操作前的底牌，执行后位于牌堆底
+    int refillCardId = -1;        // 匹配后从牌堆补到空位的牌，无则为 -1
+    CardPosition slotPosition;    // 匹配时被点击牌原来的桌面位置
+    int scoreDelta = 0;           // 本次得分变化（含抽牌罚分）
+    int combo = 0;                // 操作后的连击数
+    bool penalized = false;       // 抽牌时桌面仍有可匹配牌，被罚分
+};
+
+/**
+ * 无引擎依赖的核心游戏逻辑
+ * 持有 GameModel、撤销记录与发牌器，所有操作同步完成，不涉及动画与视图，
+ * 既供 cocos 客户端的 GameController 包装，也可在服务器端直接用于校验与模拟。
+ */
+class GameEngine
+{
+public:
+    GameEngine();
+    ~GameEngine();
+
+    GameEngine(const GameEngine&) = delete;
+    GameEngine& operator=(const GameEngine&) = delete;
+
+    /**
+     * 随机发一局新牌，复用已有模型的内存
+     * @param seed 本局种子，凭种子与总牌数可精确复现同一局
+     * @param totalCards 本局总牌数
+     */
+    void newRandomGame(uint64_t seed, int totalCards = GameModelGenerator::DEFAULT_TOTAL_CARDS);
+
+    /**
+     * 从牌局库取第 index 局，与 newRandomGame(该局种子) 得到的牌局完全一致
+     * @return 库未打开或 index 越界时返回 false，当前局保持不变
+     */
+    bool newDealGame(const DealLibrary& library, uint64_t index);
+
+    // 当前随机局的种子（关卡局为 0）
+    uint64_t getDealSeed() const { return _dealSeed; }
+
+    /**
+     * 按关卡配置发一局新牌
+     * @return 配置为空时返回 false，当前局保持不变
+     */
+    bool newLevelGame(LevelConfig* levelConfig);
+
+    GameModel* getGameModel() const { return _gameModel; }
+
+    // 计分规则，供模拟与调参替换；修改后只影响之后的操作，撤销与时间线重放按记录的原分值
+    void setScoringRules(const ScoringRules& rules) { _scoringRules = rules; }
+    const ScoringRules& getScoringRules() const { return _scoringRules; }
+
+    /**
+     * 执行一次操作
+     * @param type 操作类型
+     * @param cardId 匹配时为被点击的桌面牌ID，抽牌时忽略
+     */
+    MoveResult applyMove(MoveType type, int cardId = -1);
+    MoveResult applyMatch(int cardId);
+    MoveResult applyDraw();
+
+    // 指定桌面牌当前能否与底牌匹配
+    bool canMatch(int cardId) const;
+
+    bool canUndo() const;
+
+    // 撤销记录深度（默认 UndoManager::DEFAULT_DEPTH），0 表示禁用撤销；设置时清空已有记录
+    void setUndoDepth(int depth);
+    int getUndoDepth() const;
+
+    /**
+     * 撤销上一步操作，模型恢复到该操作之前的牌面、得分与连击
+     * 撤销记录用尽后（超出撤销深度）经由时间线检查点继续回退；撤销深度为 0 时不可撤销
+     * @return 没有可撤销的操作或撤销已禁用时返回 false
+     */
+    bool undo();
+
+    // 重做游标之后的下一步操作
+    bool canRedo() const;
+    bool redo();
+
+    /**
+     * 跳到第 moveIndex 步之后的牌面（0 为开局），可前可后
+     * 相邻步直接撤销/重做，其余恢复最近的检查点再重放不超过 K-1 步，耗时与局长无关
+     * @return moveIndex 越界时返回 false，当前局保持不变
+     */
+    bool seekToMove(int moveIndex);
+
+    // 时间线：本局已记录的操作数（含可重做部分）与当前游标
+    int getMoveCount() const { return _timeline.getMoveCount(); }
+    int getMoveIndex() const { return _timeline.getCursor(); }
+    const MoveRecord& getMoveRecord(int index) const { return _timeline.getMove(index); }
+
+    // 桌面上是否存在可与底牌匹配的牌
+    bool hasAnyMatch() const;
+
+    // 牌堆已空且无可匹配牌时本局结束
+    bool isGameOver() const;
+
+private:
+    void undoMatch(const UndoModel& record);
+    void undoDraw(const UndoModel& record);
+
+    // 操作执行后记入时间线；重放时只移动游标
+    void onMoveApplied(OperationType type, int cardId, int scoreDelta);
+    bool replayMove(const MoveRecord& move);
+
+    GameModel* _gameModel;
+    UndoManager _undoManager;
+    TimelineManager _timeline;
+    const MoveRecord* _replayMove; // 正在重放的记录，得分取记录值而非按当前规则重算；不在重放时为空
+    ScoringRules _scoringRules;
+    GameModelGenerator _modelGenerator;
+    uint64_t _dealSeed;
+};
+
+#endif // GAME_ENGINE_H
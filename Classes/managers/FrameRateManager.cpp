@@ -0,0 +1,104 @@
+#include "FrameRateManager.h"
+#include "utils/EventLog.h"
+#include "utils/Trace.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace {
+    FrameRateManager* s_instance = nullptr;
+}
+
+const float FrameRateManager::IDLE_INTERVAL = 1.0f / 10;
+const float FrameRateManager::IDLE_DELAY = 0.5f;
+
+FrameRateManager* FrameRateManager::getInstance() {
+    if (!s_instance) s_instance = new FrameRateManager();
+    return s_instance;
+}
+
+void FrameRateManager::destroyInstance() {
+    delete s_instance;
+    s_instance = nullptr;
+}
+
+FrameRateManager::FrameRateManager()
+    : _director(nullptr)
+    , _fullInterval(1.0f / 60)
+    , _lastActiveMs(0)
+    , _activeTouches(0)
+    , _keepAwake(false)
+    , _idle(false)
+    , _afterUpdateListener(nullptr)
+    , _touchListener(nullptr)
+    , _keyListener(nullptr)
+{
+}
+
+FrameRateManager::~FrameRateManager() {
+    if (!_director) return;
+    auto dispatcher = _director->getEventDispatcher();
+    dispatcher->removeEventListener(_afterUpdateListener);
+    dispatcher->removeEventListener(_touchListener);
+    dispatcher->removeEventListener(_keyListener);
+}
+
+void FrameRateManager::install(Director* director) {
+    if (_director) return;
+    _director = director;
+    _fullInterval = director->getAnimationInterval();
+    _lastActiveMs = utils::getTimeInMilliseconds();
+
+    auto dispatcher = director->getEventDispatcher();
+    _afterUpdateListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_UPDATE,
+        [this](EventCustom*) { onAfterUpdate(); });
+
+    // 固定优先级先于场景内的监听器收到触摸，且不吞没：只用来唤醒，触摸照常派发给场景
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(false);
+    _touchListener->onTouchBegan = [this](Touch*, Event*) {
+        _activeTouches++;
+        wake();
+        return true;
+    };
+    _touchListener->onTouchMoved = [this](Touch*, Event*) { wake(); };
+    auto touchFinished = [this](Touch*, Event*) {
+        _activeTouches = std::max(0, _activeTouches - 1);
+        wake();
+    };
+    _touchListener->onTouchEnded = touchFinished;
+    _touchListener->onTouchCancelled = touchFinished;
+    dispatcher->addEventListenerWithFixedPriority(_touchListener, -1);
+
+    _keyListener = EventListenerKeyboard::create();
+    _keyListener->onKeyPressed = [this](EventKeyboard::KeyCode, Event*) { wake(); };
+    dispatcher->addEventListenerWithFixedPriority(_keyListener, -1);
+}
+
+void FrameRateManager::wake() {
+    _lastActiveMs = utils::getTimeInMilliseconds();
+    setIdle(false);
+}
+
+void FrameRateManager::onAfterUpdate() {
+    double now = utils::getTimeInMilliseconds();
+    bool active = _keepAwake || _activeTouches > 0
+        || _director->getActionManager()->getNumberOfRunningActions() > 0;
+    _keepAwake = false;
+
+    if (active) {
+        _lastActiveMs = now;
+        setIdle(false);
+    } else if (!_idle && now - _lastActiveMs >= IDLE_DELAY * 1000.0) {
+        setIdle(true);
+    }
+}
+
+void FrameRateManager::setIdle(bool idle) {
+    if (idle == _idle || !_director) return;
+    _idle = idle;
+    float interval = idle ? IDLE_INTERVAL : _fullInterval;
+    _director->setAnimationInterval(interval);
+    TRACE_INSTANT(idle ? "FrameRate::idle" : "FrameRate::full");
+    EVENT_LOG(VIEW_FRAME_INTERVAL, interval * 1000.0f, idle ? 1 : 0);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef FRAME_RATE_MANAGER_H
+#define FRAME_RATE_MANAGER_H
+
+#include "cocos2d.h"
+
+/**
+ * 按需渲染的帧率管理
+ * 桌面静止时（没有运行中的 Action、没有按住的触摸、本帧无人调用 keepAwake）持续 IDLE_DELAY 秒后，
+ * 把导演的帧间隔降到空闲帧率；触摸、按键或任何 Action 开始运行时立即恢复满帧率。
+ * Action 的检测放在每帧调度器更新之后：更新中启动的 Action（含主线程派发的回调）当帧即被发现。
+ * 不以 Action 驱动的逐帧动画（如 GameView 的过渡插值）需在播放期间每帧调用 keepAwake。
+ * 空闲帧率下首个触摸最多晚一个空闲帧间隔被处理（Android 的触摸在渲染线程的帧之间派发）。
+ */
+class FrameRateManager
+{
+public:
+    static const float IDLE_INTERVAL;   // 空闲时的帧间隔（秒）
+    static const float IDLE_DELAY;      // 静止多久后降帧（秒）
+
+    static FrameRateManager* getInstance();
+    static void destroyInstance();
+
+    /**
+     * 以导演当前的帧间隔为满帧率，注册帧事件与输入监听
+     * 须在 setAnimationInterval 之后、runWithScene 之前调用
+     */
+    void install(cocos2d::Director* director);
+
+    // 本帧仍有动画，保持满帧率
+    void keepAwake() { _keepAwake = true; }
+
+    // 立即恢复满帧率（回到前台等）
+    void wake();
+
+    bool isIdle() const { return _idle; }
+
+private:
+    FrameRateManager();
+    ~FrameRateManager();
+
+    void onAfterUpdate();
+    void setIdle(bool idle);
+
+    cocos2d::Director* _director;
+    float _fullInterval;
+    double _lastActiveMs;       // 最近一次有活动的时刻
+    int _activeTouches;
+    bool _keepAwake;
+    bool _idle;
+
+    cocos2d::EventListenerCustom* _afterUpdateListener;
+    cocos2d::EventListenerTouchOneByOne* _touchListener;
+    cocos2d::EventListenerKeyboard* _keyListener;
+};
+
+#endif // FRAME_RATE_MANAGER_H
@@ -0,0 +1,126 @@
+#include "TimelineManager.h"
+#include "../models/GameModel.h"
+#include <algorithm>
+
+TimelineManager::TimelineManager(int checkpointInterval)
+    : _baseInterval(checkpointInterval > 0 && checkpointInterval <= MAX_MOVES / 2 ? checkpointInterval : DEFAULT_CHECKPOINT_INTERVAL)
+    , _checkpointInterval(_baseInterval)
+    , _cursor(0)
+{
+}
+
+void TimelineManager::init(const GameModel* gameModel)
+{
+    int cardInterval = gameModel->getCardCount() / MAX_CAPTURED_CARDS_PER_MOVE;
+    _checkpointInterval = std::min(std::max(_baseInterval, cardInterval), MAX_MOVES / 2);
+
+    _moves.clear();
+    _checkpoints.resize(1);
+    _cursor = 0;
+    capture(gameModel, 0, _checkpoints[0]);
+}
+
+void TimelineManager::recordMove(const MoveRecord& move, const GameModel* gameModel)
+{
+    if (_cursor < getMoveCount() && _moves[_cursor] == move) {
+        // 与已记录的下一步相同：沿原时间线前进，其后的操作与检查点仍然有效
+        _cursor++;
+        return;
+    }
+
+    // 分叉：游标之后的操作及其检查点全部作废
+    _moves.resize(_cursor);
+    _checkpoints.resize(_cursor / _checkpointInterval + 1);
+
+    _moves.push_back(move);
+    _cursor++;
+    if (_cursor % _checkpointInterval == 0) {
+        _checkpoints.push_back(GameSnapshot());
+        capture(gameModel, _cursor, _checkpoints.back());
+    }
+
+    // 分叉后游标总在队尾，写满时游标之前至少有一半可丢弃
+    if (getMoveCount() >= MAX_MOVES) {
+        discardOldest(MAX_MOVES / 2 / _checkpointInterval * _checkpointInterval);
+    }
+}
+
+void TimelineManager::discardOldest(int count)
+{
+    if (count <= 0 || count > _cursor) return;
+    _moves.erase(_moves.begin(), _moves.begin() + count);
+    _checkpoints.erase(_checkpoints.begin(), _checkpoints.begin() + count / _checkpointInterval);
+    for (GameSnapshot& checkpoint : _checkpoints) {
+        checkpoint.moveIndex -= count;
+    }
+    _cursor -= count;
+}
+
+void TimelineManager::setCursor(int cursor)
+{
+    if (cursor < 0) cursor = 0;
+    if (cursor > getMoveCount()) cursor = getMoveCount();
+    _cursor = cursor;
+}
+
+const GameSnapshot* TimelineManager::findCheckpoint(int moveIndex) const
+{
+    if (_checkpoints.empty()) return nullptr;
+    int index = moveIndex < 0 ? 0 : moveIndex / _checkpointInterval;
+    if (index >= static_cast<int>(_checkpoints.size())) index = static_cast<int>(_checkpoints.size()) - 1;
+    return &_checkpoints[index];
+}
+
+void TimelineManager::capture(const GameModel* gameModel, int moveIndex, GameSnapshot& outSnapshot)
+{
+    outSnapshot.moveIndex = moveIndex;
+    outSnapshot.score = gameModel->getScore();
+    outSnapshot.combo = gameModel->getCombo();
+
+    CardModel* bottomCard = gameModel->getBottomCard();
+    outSnapshot.bottomCardId = bottomCard ? static_cast<uint16_t>(bottomCard->getCardId()) : 0xFFFF;
+
+    const std::vector<CardModel*>& playFieldCards = gameModel->getPlayFieldCards();
+    outSnapshot.playFieldCards.resize(playFieldCards.size());
+    for (size_t i = 0; i < playFieldCards.size(); i++) {
+        outSnapshot.playFieldCards[i].cardId = static_cast<uint16_t>(playFieldCards[i]->getCardId());
+        outSnapshot.playFieldCards[i].position = playFieldCards[i]->getPosition();
+    }
+
+    const CardDeck& stackCards = gameModel->getStackCards();
+    outSnapshot.stackCards.resize(stackCards.size());
+    for (int i = 0; i < stackCards.size(); i++) {
+        outSnapshot.stackCards[i] = static_cast<uint16_t>(stackCards[i]->getCardId());
+    }
+}
+
+void TimelineManager::restore(const GameSnapshot& snapshot, GameModel* gameModel)
+{
+    _playFieldBuffer.clear();
+    for (const GameSnapshot::PlayFieldCard& entry : snapshot.playFieldCards) {
+        CardModel* card = gameModel->getCardById(entry.cardId);
+        if (!card) continue;
+        card->setPosition(entry.position);
+        card->setFlipped(true);
+        _playFieldBuffer.push_back(card);
+    }
+
+    CardModel* bottomCard = gameModel->getCardById(snapshot.bottomCardId);
+    if (bottomCard) {
+        bottomCard->setPosition(CardPosition());
+        bottomCard->setFlipped(true);
+    }
+
+    // 牌堆中的牌不显示，翻面状态不影响规则，统一恢复为背面朝上
+    _stackBuffer.clear();
+    for (uint16_t cardId : snapshot.stackCards) {
+        CardModel* card = gameModel->getCardById(cardId);
+        if (!card) continue;
+        card->setFlipped(false);
+        _stackBuffer.push_back(card);
+    }
+
+    gameModel->restoreLayout(_playFieldBuffer, bottomCard, _stackBuffer);
+    gameModel->setScore(snapshot.score);
+    gameModel->setCombo(snapshot.combo);
+}
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef TIMELINE_MANAGER_H
+#define TIMELINE_MANAGER_H
+
+#include "../models/TimelineModel.h"
+#include <vector>
+
+class GameModel;
+class CardModel;
+
+/**
+ * 时间线管理器
+ * 保存本局完整的操作序列与游标（当前已执行的步数），游标之后的操作可重做；
+ * 每 K 步记录一个牌面检查点。跳到任意第 n 步只需恢复第 n/K 个检查点再重放不超过 K-1 步，
+ * 耗时与局长无关。检查点要复制整局的牌，牌数很多（大牌靴）时按牌数放宽 K，使每步分摊的复制量有上限。
+ * 撤销记录（UndoManager）只负责相邻一步的快速回退。
+ * 时间线最多保留 MAX_MOVES 步：写满后丢弃最早的一半（按检查点对齐），步数从保留的第一个检查点重新计起，
+ * 无尽模式下内存占用有上限，代价是无法再跳回被丢弃的那部分牌面。
+ */
+class TimelineManager
+{
+public:
+    static const int DEFAULT_CHECKPOINT_INTERVAL = 64; // 默认每 64 步一个检查点
+    static const int MAX_MOVES = 1 << 16;               // 时间线保留的最大步数
+    static const int MAX_CAPTURED_CARDS_PER_MOVE = 16;  // 检查点按步分摊的复制牌数上限
+
+    explicit TimelineManager(int checkpointInterval = DEFAULT_CHECKPOINT_INTERVAL);
+    ~TimelineManager() = default;
+
+    /**
+     * 新的一局：清空时间线并把当前牌面记为第 0 步的检查点
+     * 本局的检查点间隔取构造时的间隔与 牌数 / MAX_CAPTURED_CARDS_PER_MOVE 中的较大者
+     */
+    void init(const GameModel* gameModel);
+
+    /**
+     * 记录刚执行的一步操作，游标前进一步
+     * 与游标处已记录的操作相同时保留后续时间线（等同于重做），否则丢弃游标之后的全部操作
+     * 步数达到 MAX_MOVES 时丢弃最早的一半，游标与检查点的步数随之前移
+     * @param gameModel 执行该操作之后的牌面，步数到 K 的倍数时据此记录检查点
+     */
+    void recordMove(const MoveRecord& move, const GameModel* gameModel);
+
+    int getMoveCount() const { return static_cast<int>(_moves.size()); }
+    int getCursor() const { return _cursor; }
+    void setCursor(int cursor);
+
+    const MoveRecord& getMove(int index) const { return _moves[index]; }
+    // 本局实际使用的检查点间隔
+    int getCheckpointInterval() const { return _checkpointInterval; }
+
+    /**
+     * 不晚于第 moveIndex 步的最近检查点，O(1)
+     * @return 时间线未初始化时返回 nullptr
+     */
+    const GameSnapshot* findCheckpoint(int moveIndex) const;
+
+    // 记录牌面检查点 / 按检查点恢复牌面（卡牌表须来自同一局）
+    static void capture(const GameModel* gameModel, int moveIndex, GameSnapshot& outSnapshot);
+    void restore(const GameSnapshot& snapshot, GameModel* gameModel);
+
+private:
+    // 丢弃最早的 count 步（count 为检查点间隔的倍数）
+    void discardOldest(int count);
+
+    int _baseInterval;       // 构造时指定的间隔
+    int _checkpointInterval; // 本局的间隔，init 时按牌数确定
+    int _cursor;
+    std::vector<MoveRecord> _moves;          // 本局全部操作，含游标之后可重做的部分
+    std::vector<GameSnapshot> _checkpoints;  // 第 i 个对应第 i*K 步
+    std::vector<CardModel*> _playFieldBuffer; // restore 时的临时缓冲，跨次复用容量
+    std::vector<CardModel*> _stackBuffer;
+};
+
+#endif // TIMELINE_MANAGER_H
@@ -1,52 +1,39 @@
 #include "UndoManager.h"
+#include "../utils/EventLog.h"
 
-UndoManager::UndoManager()
+UndoManager::UndoManager(int depth)
+    : _records(depth)
 {
 }
 
-UndoManager::~UndoManager()
-{
-    clear();
-}
-
 void UndoManager::init()
 {
     clear();
 }
 
-void UndoManager::pushUndoRecord(UndoModel* undoModel)
+void UndoManager::setDepth(int depth)
 {
-    if (undoModel) {
-        _undoStack.push_back(undoModel);
-        CCLOG("UndoManager: Pushed undo record, stack size: %d", _undoStack.size());
-    }
+    _records.setCapacity(depth);
+    EVENT_LOG(UNDO_DEPTH_SET, _records.capacity());
 }
 
-UndoModel* UndoManager::popUndoRecord()
+void UndoManager::pushUndoRecord(const UndoModel& record)
 {
-    if (_undoStack.empty()) {
-        CCLOG("UndoManager: Stack is empty");
-        return nullptr;
-    }
-
-    UndoModel* undoModel = _undoStack.back();
-    _undoStack.pop_back();
-    CCLOG("UndoManager: Popped undo record, stack size: %d", _undoStack.size());
-    return undoModel;
+    _records.pushBack(record);
+    EVENT_LOG(UNDO_PUSH, record.operationType, record.cardId, _records.size());
 }
 
-bool UndoManager::canUndo() const
+bool UndoManager::popUndoRecord(UndoModel& outRecord)
 {
-    bool canUndo = !_undoStack.empty();
-    CCLOG("UndoManager: canUndo=%d, stack size=%d", canUndo, _undoStack.size());
-    return canUndo;
+    if (_records.empty()) return false;
+    outRecord = _records.back();
+    _records.popBack();
+    EVENT_LOG(UNDO_POP, outRecord.operationType, outRecord.cardId, _records.size());
+    return true;
 }
 
 void UndoManager::clear()
 {
-    for (std::vector<UndoModel*>::iterator it = _undoStack.begin(); it != _undoStack.end(); ++it) {
-        delete* it;
-    }
-    _undoStack.clear();
-    CCLOG("UndoManager: Cleared all undo records");
-}
\ No newline at end of file
+    _records.clear();
+    EVENT_LOG(UNDO_CLEARED);
+}
@@ -3,17 +3,21 @@
 #define UNDO_MANAGER_H
 
 #include "../models/UndoModel.h"
-#include <vector>
+#include "../utils/RingBuffer.h"
 
 /**
  * 
  * ܣʷ¼
+ * ¼ֵڶݻλУȿãд󸲸ɵļ¼
+ * ޾ģʽʷռõڴ治ֳ
  */
 class UndoManager
 {
 public:
-    UndoManager();
-    ~UndoManager();
+    static const int DEFAULT_DEPTH = 256; // ĬϿɳĲ
+
+    explicit UndoManager(int depth = DEFAULT_DEPTH);
+    ~UndoManager() = default;
 
     /**
      * ʼ
@@ -21,22 +25,33 @@ public:
     void init();
 
     /**
-     * ӳ¼
-     * @param undoModel ģ
+     * ÿɳм¼
+     * @param depth 0 ʾó
      */
-    void pushUndoRecord(UndoModel* undoModel);
+    void setDepth(int depth);
+    int getDepth() const { return _records.capacity(); }
+
+    /**
+     * ӳ¼ʷʱɵһ
+     * @param record ¼
+     */
+    void pushUndoRecord(const UndoModel& record);
 
     /**
      * ĳ¼
-     * @return ģͣûм¼nullptr
+     * @param outRecord ĳ¼
+     * @return ûм¼ʱ false
      */
-    UndoModel* popUndoRecord();
+    bool popUndoRecord(UndoModel& outRecord);
 
     /**
      * ǷпɳĲ
      * @return ǷпɳĲ
      */
-    bool canUndo() const;
+    bool canUndo() const { return !_records.empty(); }
+
+    // ǰɳĲ
+    int size() const { return _records.size(); }
 
     /**
      * г¼
@@ -44,7 +59,7 @@ public:
     void clear();
 
 private:
-    std::vector<UndoModel*> _undoStack; // ջ
+    RingBuffer<UndoModel> _records; // ¼µڶβ
 };
 
-#endif // UNDO_MANAGER_H
\ No newline at end of file
+#endif // UNDO_MANAGER_H
@@ -0,0 +1,76 @@
+#include "CardDeck.h"
+
+namespace {
+    const int MIN_CAPACITY = 64;
+}
+
+CardDeck::CardDeck()
+    : _slots(MIN_CAPACITY, nullptr)
+    , _mask(MIN_CAPACITY - 1)
+    , _head(0)
+    , _count(0)
+{
+}
+
+void CardDeck::pushFront(CardModel* card)
+{
+    if (_count == static_cast<int>(_slots.size())) grow();
+    _head = (_head - 1) & _mask;
+    _slots[_head] = card;
+    ++_count;
+}
+
+CardModel* CardDeck::popFront()
+{
+    if (_count == 0) return nullptr;
+    CardModel* card = _slots[_head];
+    _head = (_head + 1) & _mask;
+    --_count;
+    return card;
+}
+
+void CardDeck::pushBack(CardModel* card)
+{
+    if (_count == static_cast<int>(_slots.size())) grow();
+    _slots[(_head + _count) & _mask] = card;
+    ++_count;
+}
+
+CardModel* CardDeck::popBack()
+{
+    if (_count == 0) return nullptr;
+    --_count;
+    return _slots[(_head + _count) & _mask];
+}
+
+void CardDeck::clear()
+{
+    _head = 0;
+    _count = 0;
+}
+
+void CardDeck::reserve(int capacity)
+{
+    while (static_cast<int>(_slots.size()) < capacity) grow();
+}
+
+void CardDeck::assign(const std::vector<CardModel*>& cards)
+{
+    clear();
+    reserve(static_cast<int>(cards.size()));
+    for (auto card : cards) {
+        _slots[_count++] = card;
+    }
+}
+
+void CardDeck::grow()
+{
+    // 扩容时顺便把环展开，新容量下 _head 归零
+    std::vector<CardModel*> slots(_slots.size() * 2, nullptr);
+    for (int i = 0; i < _count; i++) {
+        slots[i] = (*this)[i];
+    }
+    _slots.swap(slots);
+    _mask = static_cast<int>(_slots.size()) - 1;
+    _head = 0;
+}
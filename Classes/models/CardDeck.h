@@ -0,0 +1,53 @@
+#pragma once
+#ifndef CARD_DECK_H
+#define CARD_DECK_H
+
+#include <vector>
+
+class CardModel;
+
+/**
+ * 牌堆（环形缓冲区）
+ * 两端的压入/弹出都是 O(1)，不搬移其余元素。
+ * 约定与原先的 std::vector 牌堆一致：back() 为牌堆顶（下一张抽出的牌），
+ * front() 为牌堆底（底牌回收时放入的位置），operator[](0) 即 front()。
+ */
+class CardDeck
+{
+public:
+    CardDeck();
+    ~CardDeck() = default;
+
+    int size() const { return _count; }
+    bool empty() const { return _count == 0; }
+
+    CardModel* front() const { return _slots[_head]; }
+    CardModel* back() const { return _slots[(_head + _count - 1) & _mask]; }
+    CardModel* operator[](int index) const { return _slots[(_head + index) & _mask]; }
+
+    // 放入牌堆底 / 从牌堆底取出
+    void pushFront(CardModel* card);
+    CardModel* popFront();
+
+    // 放入牌堆顶 / 从牌堆顶取出
+    void pushBack(CardModel* card);
+    CardModel* popBack();
+
+    void clear();
+
+    // 预留容量（向上取整到 2 的幂），之后在该容量内的操作不再分配内存
+    void reserve(int capacity);
+
+    // 按 vector 顺序整体替换牌堆内容（cards.back() 为牌堆顶）
+    void assign(const std::vector<CardModel*>& cards);
+
+private:
+    void grow();
+
+    std::vector<CardModel*> _slots; // 容量恒为 2 的幂
+    int _mask;                      // _slots.size() - 1
+    int _head;                      // front() 所在槽位
+    int _count;                     // 当前牌数
+};
+
+#endif // CARD_DECK_H
@@ -2,7 +2,7 @@
 #ifndef CARD_DEFINES_H
 #define CARD_DEFINES_H
 
-#include "cocos2d.h"
+#include <cstdint>
 
 /**
  * ƻɫ
@@ -39,20 +39,47 @@ enum class CardFaceType
     NUM_CARD_FACE_TYPES
 };
 
+/**
+ * 뻨ɫЧΧڣ NONE± suit * 13 + face  [0, 52)
+ * ؿؿʱܾЧ
+ */
+inline bool isValidCard(CardFaceType face, CardSuitType suit)
+{
+    return static_cast<int>(face) >= 0 && face < CardFaceType::NUM_CARD_FACE_TYPES
+        && static_cast<int>(suit) >= 0 && suit < CardSuitType::NUM_CARD_SUIT_TYPES;
+}
+
 /**
  * Ϸ
  */
 enum class GameAreaType
 {
+    NONE = -1,  // κƶ;У
     PLAY_FIELD, // Ϸ
     BOTTOM,     // ײ
     STACK       // ѵ
 };
 
+/**
+ * 
+ * ģͲ㲻棬ͼתΪ cocos2d::Vec2
+ */
+struct CardPosition
+{
+    float x;
+    float y;
+
+    CardPosition() : x(0.0f), y(0.0f) {}
+    CardPosition(float px, float py) : x(px), y(py) {}
+
+    bool operator==(const CardPosition& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const CardPosition& other) const { return !(*this == other); }
+};
+
 /**
  * ͣڳܣ
  */
-enum class OperationType
+enum class OperationType : uint8_t
 {
     CARD_MATCH,     // ƥ
     DRAW_CARD,      // 鿨
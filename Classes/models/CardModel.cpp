@@ -1,20 +1,30 @@
 #include "CardModel.h"
+#include "../services/MatchRules.h"
 
 CardModel::CardModel()
     : _suit(CardSuitType::NONE)
     , _face(CardFaceType::NONE)
-    , _position(cocos2d::Vec2::ZERO)
+    , _position()
     , _flipped(false)
     , _cardId(0)
+    , _area(GameAreaType::NONE)
+    , _kindIndex(MatchRules::INVALID_KIND)
 {
 }
 
+void CardModel::updateKindIndex()
+{
+    _kindIndex = isValidCard(_face, _suit)
+        ? static_cast<int>(_suit) * MatchRules::FACE_COUNT + static_cast<int>(_face)
+        : MatchRules::INVALID_KIND;
+}
+
 int CardModel::getFaceValue() const
 {
     return static_cast<int>(_face) + 1; // ACE=0+1=1, TWO=1+1=2, ..., KING=12+1=13
 }
 
-void CardModel::updatePositionToArea(const cocos2d::Vec2& areaPosition)
+void CardModel::updatePositionToArea(const CardPosition& areaPosition)
 {
     _position = areaPosition;
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #ifndef CARD_MODEL_H
 #define CARD_MODEL_H
 
-#include "cocos2d.h"
 #include "CardDefines.h"
 
 /**
@@ -17,36 +16,48 @@ public:
 
     // ȡÿƻɫ
     CardSuitType getSuit() const { return _suit; }
-    void setSuit(CardSuitType suit) { _suit = suit; }
+    void setSuit(CardSuitType suit) { _suit = suit; updateKindIndex(); }
 
     // ȡÿֵ
     CardFaceType getFace() const { return _face; }
-    void setFace(CardFaceType face) { _face = face; }
+    void setFace(CardFaceType face) { _face = face; updateKindIndex(); }
 
     // ȡÿλ
-    cocos2d::Vec2 getPosition() const { return _position; }
-    void setPosition(const cocos2d::Vec2& position) { _position = position; }
+    const CardPosition& getPosition() const { return _position; }
+    void setPosition(const CardPosition& position) { _position = position; }
 
     // ȡÿƷת״̬
     bool isFlipped() const { return _flipped; }
     void setFlipped(bool flipped) { _flipped = flipped; }
 
-    // ȡÿΨһID
+    // ȡÿIDڴ 0 ʼţ GameModel 䣩
     int getCardId() const { return _cardId; }
     void setCardId(int cardId) { _cardId = cardId; }
 
+    // ȡÿƵǰ GameModel ά
+    GameAreaType getArea() const { return _area; }
+    void setArea(GameAreaType area) { _area = area; }
+
     // ȡֵA=1, J=11, Q=12, K=13
     int getFaceValue() const;
 
+    // ȡ± suit * 13 + face0-51ɫЧʱΪ MatchRules::INVALID_KINDڲ MatchTable
+    int getKindIndex() const { return _kindIndex; }
+
     // ¿λõĿ
-    void updatePositionToArea(const cocos2d::Vec2& areaPosition);
+    void updatePositionToArea(const CardPosition& areaPosition);
 
 private:
+    // ɫֵ仯ʱ±꣬ʱжЧ
+    void updateKindIndex();
+
     CardSuitType _suit;        // ɫ
     CardFaceType _face;        // ֵ
-    cocos2d::Vec2 _position;   // λ
+    CardPosition _position;    // λ
     bool _flipped;             // Ƿת
-    int _cardId;               // ΨһID
+    int _cardId;               // ID
+    GameAreaType _area;        // 
+    int _kindIndex;            // ±
 };
 
 #endif // CARD_MODEL_H
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "CardPool.h"
+
+CardPool::CardPool()
+    : _used(0)
+{
+}
+
+CardModel* CardPool::acquire()
+{
+    if (_used == capacity()) {
+        _blocks.emplace_back(new CardModel[BLOCK_SIZE]);
+    }
+
+    CardModel* card = &_blocks[_used / BLOCK_SIZE][_used % BLOCK_SIZE];
+    *card = CardModel(); // 复用的槽位可能残留上一局的数据
+    ++_used;
+    return card;
+}
+
+void CardPool::reset()
+{
+    _used = 0;
+}
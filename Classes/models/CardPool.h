@@ -0,0 +1,49 @@
+#pragma once
+#ifndef CARD_POOL_H
+#define CARD_POOL_H
+
+#include "CardModel.h"
+#include <memory>
+#include <vector>
+
+/**
+ * 卡牌对象池
+ * 以固定大小的连续块分配 CardModel，块一经分配不再移动，
+ * 因此 acquire 返回的指针在 reset 之前始终有效。
+ * reset 只把游标归零：整局卡牌一次性回收，已有的块留给下一局复用，
+ * 重新发牌时不再产生任何堆分配。
+ */
+class CardPool
+{
+public:
+    static const int BLOCK_SIZE = 64; // 每块容纳的卡牌数，标准一局 56 张只需一块
+
+    CardPool();
+    ~CardPool() = default;
+
+    CardPool(const CardPool&) = delete;
+    CardPool& operator=(const CardPool&) = delete;
+
+    /**
+     * 取出一张处于默认状态的卡牌
+     * @return 卡牌指针，生命周期由对象池管理，调用方不得 delete
+     */
+    CardModel* acquire();
+
+    /**
+     * 回收本局分配的全部卡牌（O(1)，不释放内存）
+     */
+    void reset();
+
+    // 当前已分配的卡牌数量
+    int size() const { return _used; }
+
+    // 无需再向系统申请内存即可容纳的卡牌数量
+    int capacity() const { return static_cast<int>(_blocks.size()) * BLOCK_SIZE; }
+
+private:
+    std::vector<std::unique_ptr<CardModel[]>> _blocks; // 连续卡牌块
+    int _used;                                         // 已分配数量
+};
+
+#endif // CARD_POOL_H
@@ -1,4 +1,6 @@
 #include "GameModel.h"
+#include "../services/MatchRules.h"
+#include "../utils/EventLog.h"
 
 GameModel::GameModel()
     : _bottomCard(nullptr)
@@ -7,53 +9,127 @@ GameModel::GameModel()
 
 GameModel::~GameModel()
 {
-    // 清理所有卡牌对象
-    for (auto card : _playFieldCards) {
-        delete card;
-    }
-    for (auto card : _stackCards) {
-        delete card;
-    }
-    if (_bottomCard) {
-        delete _bottomCard;
+    // 卡牌由 _cardPool 持有，随对象池整体释放
+}
+
+CardModel* GameModel::createCard()
+{
+    CardModel* card = _cardPool.acquire();
+    card->setCardId(static_cast<int>(_cardTable.size()));
+    _cardTable.push_back(card);
+    return card;
+}
+
+void GameModel::reset()
+{
+    _playFieldCards.clear();
+    _stackCards.clear();
+    _bottomCard = nullptr;
+    for (int i = 0; i < KIND_COUNT; i++) {
+        _playFieldKindCounts[i] = 0;
     }
+    _playFieldKindMask = 0;
+    _score = 0;
+    _combo = 0;
+    _cardTable.clear();
+    _cardPool.reset();
 }
 
 void GameModel::setPlayFieldCards(const std::vector<CardModel*>& cards)
 {
+    for (auto card : _playFieldCards) {
+        onPlayFieldCardRemoved(card);
+    }
     _playFieldCards = cards;
-    updateCardMap();
+    for (auto card : _playFieldCards) {
+        onPlayFieldCardAdded(card);
+    }
 }
 
 void GameModel::setBottomCard(CardModel* card)
 {
+    // 旧底牌若已被调用方移到其他区域则保留其区域
+    if (_bottomCard && _bottomCard->getArea() == GameAreaType::BOTTOM) {
+        _bottomCard->setArea(GameAreaType::NONE);
+    }
     _bottomCard = card;
     if (card) {
-        _cardMap[card->getCardId()] = card;
+        card->setArea(GameAreaType::BOTTOM);
     }
 }
 
 void GameModel::setStackCards(const std::vector<CardModel*>& cards)
 {
-    _stackCards = cards;
-    updateCardMap();
+    for (int i = 0; i < _stackCards.size(); i++) {
+        _stackCards[i]->setArea(GameAreaType::NONE);
+    }
+    _stackCards.assign(cards);
+    for (auto card : cards) {
+        card->setArea(GameAreaType::STACK);
+    }
+}
+
+void GameModel::pushCardToStackBottom(CardModel* card)
+{
+    if (!card) return;
+    _stackCards.pushFront(card);
+    card->setArea(GameAreaType::STACK);
+}
+
+CardModel* GameModel::popCardFromStackBottom()
+{
+    CardModel* card = _stackCards.popFront();
+    if (card) card->setArea(GameAreaType::NONE);
+    return card;
+}
+
+void GameModel::pushCardToStackTop(CardModel* card)
+{
+    if (!card) return;
+    _stackCards.pushBack(card);
+    card->setArea(GameAreaType::STACK);
+}
+
+void GameModel::restoreLayout(const std::vector<CardModel*>& playFieldCards, CardModel* bottomCard,
+    const std::vector<CardModel*>& stackCards)
+{
+    // 各区域的卡牌会互相交换，不能逐个区域调用 setter（后设的区域会把先设的牌标回 NONE）
+    for (int i = 0; i < KIND_COUNT; i++) {
+        _playFieldKindCounts[i] = 0;
+    }
+    _playFieldKindMask = 0;
+    for (auto card : _cardTable) {
+        card->setArea(GameAreaType::NONE);
+    }
+
+    _playFieldCards = playFieldCards;
+    for (auto card : _playFieldCards) {
+        onPlayFieldCardAdded(card);
+    }
+
+    _bottomCard = bottomCard;
+    if (bottomCard) bottomCard->setArea(GameAreaType::BOTTOM);
+
+    _stackCards.assign(stackCards);
+    for (auto card : stackCards) {
+        card->setArea(GameAreaType::STACK);
+    }
 }
 
 CardModel* GameModel::getCardById(int cardId) const
 {
-    auto it = _cardMap.find(cardId);
-    if (it != _cardMap.end()) {
-        return it->second;
+    if (cardId < 0 || cardId >= static_cast<int>(_cardTable.size())) {
+        return nullptr;
     }
-    return nullptr;
+    return _cardTable[cardId];
 }
 
 bool GameModel::removeCardFromPlayField(int cardId)
 {
     for (auto it = _playFieldCards.begin(); it != _playFieldCards.end(); ++it) {
         if ((*it)->getCardId() == cardId) {
+            onPlayFieldCardRemoved(*it);
             _playFieldCards.erase(it);
-            _cardMap.erase(cardId);
             return true;
         }
     }
@@ -63,76 +139,50 @@ bool GameModel::removeCardFromPlayField(int cardId)
 CardModel* GameModel::drawCardFromStack()
 {
     if (_stackCards.empty()) {
-        CCLOG("GameModel: Stack is empty, cannot draw");
+        EVENT_LOG(MODEL_STACK_EMPTY);
         return nullptr;
     }
 
-    CardModel* topCard = _stackCards.back();
-    _stackCards.pop_back();
-
-    // 更新卡牌映射
-    _cardMap.erase(topCard->getCardId());
+    CardModel* topCard = _stackCards.popBack();
+    topCard->setArea(GameAreaType::NONE);
 
-    CCLOG("GameModel: Drew card %d from stack, remaining stack size: %d",
-        topCard->getCardId(), _stackCards.size());
+    EVENT_LOG(MODEL_DRAW_FROM_STACK, topCard->getCardId(), _stackCards.size());
 
     return topCard;
 }
 
 void GameModel::addCardToBottom(CardModel* card)
 {
-    CCLOG("GameModel: Adding card %d to bottom, current bottom card: %p",
-        card ? card->getCardId() : -1, _bottomCard);
+    EVENT_LOG(MODEL_ADD_TO_BOTTOM, card ? card->getCardId() : -1, _bottomCard ? _bottomCard->getCardId() : -1);
 
     if (_bottomCard) {
         // 将当前底部卡牌移回堆栈（如果需要）
-        CCLOG("GameModel: Moving current bottom card %d back to stack", _bottomCard->getCardId());
-        _stackCards.insert(_stackCards.begin(), _bottomCard);
+        _stackCards.pushFront(_bottomCard);
+        _bottomCard->setArea(GameAreaType::STACK);
     }
 
     _bottomCard = card;
     if (card) {
-        _cardMap[card->getCardId()] = card;
-        CCLOG("GameModel: New bottom card set to %d", card->getCardId());
+        card->setArea(GameAreaType::BOTTOM);
     }
-
-    CCLOG("GameModel: Stack size after addToBottom: %d", _stackCards.size());
 }
 
-void GameModel::updateCardMap()
-{
-    _cardMap.clear();
-    for (auto card : _playFieldCards) {
-        _cardMap[card->getCardId()] = card;
-    }
-    for (auto card : _stackCards) {
-        _cardMap[card->getCardId()] = card;
-    }
-    if (_bottomCard) {
-        _cardMap[_bottomCard->getCardId()] = _bottomCard;
-    }
-}
-
-CardModel* GameModel::drawCardFromStackToPlayField(const cocos2d::Vec2& position)
+CardModel* GameModel::drawCardFromStackToPlayField(const CardPosition& position)
 {
     if (_stackCards.empty()) {
-        CCLOG("GameModel: Stack is empty, cannot draw to play field");
+        EVENT_LOG(MODEL_STACK_EMPTY);
         return nullptr;
     }
 
-    CardModel* topCard = _stackCards.back();
-    _stackCards.pop_back();
+    CardModel* topCard = _stackCards.popBack();
 
     // 设置卡牌位置和状态
     topCard->setPosition(position);
     topCard->setFlipped(true); // 桌面卡牌正面朝上
     _playFieldCards.push_back(topCard);
+    onPlayFieldCardAdded(topCard);
 
-    // 更新映射表
-    _cardMap[topCard->getCardId()] = topCard;
-
-    CCLOG("GameModel: Drew card %d from stack to play field at (%.1f, %.1f), stack remaining: %d",
-        topCard->getCardId(), position.x, position.y, _stackCards.size());
+    EVENT_LOG(MODEL_DRAW_TO_PLAY_FIELD, topCard->getCardId(), position.x, position.y, _stackCards.size());
 
     return topCard;
 }
@@ -141,7 +191,51 @@ void GameModel::addCardToPlayField(CardModel* card)
 {
     if (card) {
         _playFieldCards.push_back(card);
-        _cardMap[card->getCardId()] = card;
-        CCLOG("GameModel: Added card %d to play field", card->getCardId());
+        onPlayFieldCardAdded(card);
+        EVENT_LOG(MODEL_ADD_TO_PLAY_FIELD, card->getCardId());
+    }
+}
+
+bool GameModel::hasMatchForBottom() const
+{
+    if (!_bottomCard) return false;
+    return (_playFieldKindMask & GameMatchTable::kindMask(_bottomCard->getKindIndex())) != 0;
+}
+
+int GameModel::getPlayFieldFaceCount(CardFaceType face) const
+{
+    int index = static_cast<int>(face);
+    if (index < 0 || index >= FACE_COUNT) return 0;
+    int count = 0;
+    for (int kind = index; kind < KIND_COUNT; kind += FACE_COUNT) {
+        count += _playFieldKindCounts[kind];
+    }
+    return count;
+}
+
+uint16_t GameModel::getPlayFieldFaceMask() const
+{
+    // 四种花色各占 13 位，折叠到一起即为面值集合
+    uint64_t m = _playFieldKindMask;
+    return static_cast<uint16_t>((m | (m >> 13) | (m >> 26) | (m >> 39)) & 0x1FFF);
+}
+
+void GameModel::onPlayFieldCardAdded(CardModel* card)
+{
+    card->setArea(GameAreaType::PLAY_FIELD);
+    int kind = card->getKindIndex();
+    if (kind < 0 || kind >= KIND_COUNT) return;
+    if (_playFieldKindCounts[kind]++ == 0) {
+        _playFieldKindMask |= uint64_t(1) << kind;
+    }
+}
+
+void GameModel::onPlayFieldCardRemoved(CardModel* card)
+{
+    card->setArea(GameAreaType::NONE);
+    int kind = card->getKindIndex();
+    if (kind < 0 || kind >= KIND_COUNT) return;
+    if (--_playFieldKindCounts[kind] == 0) {
+        _playFieldKindMask &= ~(uint64_t(1) << kind);
     }
 }
\ No newline at end of file
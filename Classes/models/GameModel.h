@@ -2,10 +2,11 @@
 #ifndef GAME_MODEL_H
 #define GAME_MODEL_H
 
-#include "cocos2d.h"
 #include "CardModel.h"
+#include "CardPool.h"
+#include "CardDeck.h"
 #include <vector>
-#include <unordered_map>
+#include <cstdint>
 
 class CardModel;
 
@@ -15,20 +16,59 @@ public:
     GameModel();
     ~GameModel();
 
+    /**
+     * 从本局对象池中创建一张卡牌，卡牌随 GameModel 一起回收，调用方不得 delete
+     * 卡牌ID按创建顺序从 0 连续分配，reset 后重新从 0 开始
+     */
+    CardModel* createCard();
+
+    /**
+     * 清空整局数据并一次性回收全部卡牌，容器与对象池的内存保留给下一局复用
+     */
+    void reset();
+
     const std::vector<CardModel*>& getPlayFieldCards() const { return _playFieldCards; }
     void setPlayFieldCards(const std::vector<CardModel*>& cards);
 
     CardModel* getBottomCard() const { return _bottomCard; }
     void setBottomCard(CardModel* card);
 
-    const std::vector<CardModel*>& getStackCards() const { return _stackCards; }
+    const CardDeck& getStackCards() const { return _stackCards; }
     void setStackCards(const std::vector<CardModel*>& cards);
 
+    // 牌堆两端的 O(1) 操作：底部用于回收底牌，顶部用于抽牌
+    void pushCardToStackBottom(CardModel* card);
+    CardModel* popCardFromStackBottom();
+    void pushCardToStackTop(CardModel* card);
+
+    /**
+     * 桌面上是否存在可与底牌匹配的牌
+     * 基于桌面牌种直方图：与 GameMatchTable 的匹配位表做一次位与，与桌面牌数无关
+     */
+    bool hasMatchForBottom() const;
+
+    // 桌面上某种面值的牌数 / 桌面已有面值集合（第 i 位对应 CardFaceType i）
+    int getPlayFieldFaceCount(CardFaceType face) const;
+    uint16_t getPlayFieldFaceMask() const;
+
+    // 桌面已有牌种集合（第 k 位对应牌种 k = suit * 13 + face）
+    uint64_t getPlayFieldKindMask() const { return _playFieldKindMask; }
+
+    // 按ID直接索引本局卡牌表，无论卡牌当前处于哪个区域
     CardModel* getCardById(int cardId) const;
+    int getCardCount() const { return static_cast<int>(_cardTable.size()); }
+
+    /**
+     * 整体重排各区域（时间线恢复检查点时使用），不改动卡牌表
+     * 三个区域须恰好覆盖本局全部卡牌，卡牌区域与桌面直方图随之重建
+     */
+    void restoreLayout(const std::vector<CardModel*>& playFieldCards, CardModel* bottomCard,
+        const std::vector<CardModel*>& stackCards);
+
     bool removeCardFromPlayField(int cardId);
     CardModel* drawCardFromStack();
     void addCardToBottom(CardModel* card);
-    CardModel* drawCardFromStackToPlayField(const cocos2d::Vec2& position);
+    CardModel* drawCardFromStackToPlayField(const CardPosition& position);
     void addCardToPlayField(CardModel* card);
 
     int getScore() const { return _score; }
@@ -39,17 +79,28 @@ public:
     int getCombo() const { return _combo; }
     void addCombo() { _combo++; }
     void resetCombo() { _combo = 0; }
-    int getStackRemaining() const { return static_cast<int>(_stackCards.size()); }
+    void setCombo(int combo) { _combo = combo; }
+    int getStackRemaining() const { return _stackCards.size(); }
 
 private:
+    static const int FACE_COUNT = static_cast<int>(CardFaceType::NUM_CARD_FACE_TYPES);
+    static const int KIND_COUNT = FACE_COUNT * static_cast<int>(CardSuitType::NUM_CARD_SUIT_TYPES);
+
+    // 维护桌面牌种直方图，所有桌面增删都经由这两个函数
+    void onPlayFieldCardAdded(CardModel* card);
+    void onPlayFieldCardRemoved(CardModel* card);
+
     std::vector<CardModel*> _playFieldCards;
     CardModel* _bottomCard = nullptr;
-    std::vector<CardModel*> _stackCards;
+    CardDeck _stackCards;
     int _score = 0;
     int _combo = 0;
 
-    std::unordered_map<int, CardModel*> _cardMap;
-    void updateCardMap();
+    int _playFieldKindCounts[KIND_COUNT] = {}; // 桌面各牌种牌数
+    uint64_t _playFieldKindMask = 0;           // 桌面牌数非零的牌种集合
+
+    CardPool _cardPool;                 // 本局全部卡牌的存储
+    std::vector<CardModel*> _cardTable; // 卡牌ID -> 卡牌，ID 即下标
 };
 
 #endif
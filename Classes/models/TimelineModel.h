@@ -0,0 +1,48 @@
+#pragma once
+#ifndef TIMELINE_MODEL_H
+#define TIMELINE_MODEL_H
+
+#include "CardDefines.h"
+#include <vector>
+
+/**
+ * 时间线上的一步操作（8 字节 POD）
+ * 引擎是确定性的：从同一牌面重放同样的操作序列必然得到同样的牌面；
+ * 得分按记录时的变化量重放，与之后替换的计分规则无关
+ */
+struct MoveRecord
+{
+    OperationType operationType; // CARD_MATCH 或 DRAW_CARD
+    uint8_t reserved;
+    uint16_t cardId;             // 匹配时为被点击的桌面牌，抽牌时为抽到的牌
+    int32_t scoreDelta;          // 本步得分变化（含抽牌罚分），由 GameEngine 记录时填写
+
+    bool operator==(const MoveRecord& other) const
+    {
+        return operationType == other.operationType && cardId == other.cardId && scoreDelta == other.scoreDelta;
+    }
+};
+
+static_assert(sizeof(MoveRecord) == 8, "MoveRecord must stay a compact 8-byte record");
+
+/**
+ * 牌面检查点
+ * 只记录各区域的卡牌ID顺序与桌面位置，卡牌本身（点数、花色）整局不变，由卡牌表提供
+ */
+struct GameSnapshot
+{
+    struct PlayFieldCard
+    {
+        uint16_t cardId;
+        CardPosition position;
+    };
+
+    int moveIndex = 0;                        // 检查点对应的步数（已执行的操作数）
+    int score = 0;
+    int combo = 0;
+    uint16_t bottomCardId = 0xFFFF;           // 无底牌时为 0xFFFF
+    std::vector<PlayFieldCard> playFieldCards; // 桌面牌，按桌面顺序
+    std::vector<uint16_t> stackCards;          // 牌堆，由牌堆底到牌堆顶
+};
+
+#endif // TIMELINE_MODEL_H
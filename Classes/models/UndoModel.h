@@ -2,57 +2,27 @@
 #ifndef UNDO_MODEL_H
 #define UNDO_MODEL_H
 
-#include "cocos2d.h"
 #include "CardDefines.h"
 
 /**
- * ģ
- * ¼һβڻ˹
+ * ¼
+ * һβĽֵͣ16 ֽ PODֵ UndoManager ĻλУ¼볷ڴ档
+ *  IDֿƱ±꣩¼λãλù̶
+ * ƥʱɵȻصƶѣλƱȻռݱԭλá
  */
-class UndoModel
+struct UndoModel
 {
-    int _specialCardId;
-    cocos2d::Vec2 _specialPosition;
-public:
-    UndoModel();
-    ~UndoModel() = default;
-
-    // ȡò
-    OperationType getOperationType() const { return _operationType; }
-    void setOperationType(OperationType type) { _operationType = type; }
-
-    // ڿƥ¼ƥƺ֮ǰĵ
-    int getMatchedCardId() const { return _matchedCardId; }
-    void setMatchedCardId(int cardId) { _matchedCardId = cardId; }
-
-    int getPreviousBottomCardId() const { return _previousBottomCardId; }
-    void setPreviousBottomCardId(int cardId) { _previousBottomCardId = cardId; }
-
-    // ڳƲ¼֮ǰĵ
-    int getNewBottomCardId() const { return _newBottomCardId; }
-    void setNewBottomCardId(int cardId) { _newBottomCardId = cardId; }
-
-    // ȡòǰĵλ
-    const cocos2d::Vec2& getPreviousBottomPosition() const { return _previousBottomPosition; }
-    void setPreviousBottomPosition(const cocos2d::Vec2& position) { _previousBottomPosition = position; }
-
-    // ȡòǰƥλ
-    const cocos2d::Vec2& getMatchedCardPosition() const { return _matchedCardPosition; }
-    void setMatchedCardPosition(const cocos2d::Vec2& position) { _matchedCardPosition = position; }
-
-    int getSpecialCardId() const { return _specialCardId; }
-    void setSpecialCardId(int cardId) { _specialCardId = cardId; }
-
-    const cocos2d::Vec2& getSpecialPosition() const { return _specialPosition; }
-    void setSpecialPosition(const cocos2d::Vec2& position) { _specialPosition = position; }
-
-private:
-    OperationType _operationType;           // 
-    int _matchedCardId;                     // ƥID
-    int _previousBottomCardId;              // ֮ǰĵID
-    int _newBottomCardId;                   // µĵIDԳƲ
-    cocos2d::Vec2 _previousBottomPosition;  // ǰλ
-    cocos2d::Vec2 _matchedCardPosition;     // ǰƥλ
+    static const uint16_t NO_CARD = 0xFFFF;
+
+    OperationType operationType; // 
+    uint8_t reserved;
+    uint16_t cardId;             // ƥʱΪƣʱΪ鵽ƣĵ
+    uint16_t previousBottomId;   // ǰĵƣλƶѵ
+    uint16_t refillCardId;       // ƥƶѲλƣʱΪ NO_CARD
+    int32_t scoreDelta;          // ε÷ֱ仯Ʒ֣
+    int32_t comboDelta;          // 仯ƶʱΪԭ
 };
 
-#endif // UNDO_MODEL_H
\ No newline at end of file
+static_assert(sizeof(UndoModel) == 16, "UndoModel must stay a compact 16-byte record");
+
+#endif // UNDO_MODEL_H
@@ -0,0 +1,171 @@
+#include "BootScene.h"
+#include "GameScene.h"
+#include "../core/GameEngine.h"
+#include "../services/RandomService.h"
+#include "../views/CardFaceCache.h"
+#include "../managers/FrameRateManager.h"
+#include "../utils/EventLog.h"
+#include "../utils/Trace.h"
+
+USING_NS_CC;
+
+namespace {
+    const Rect PROGRESS_RECT(240, 1000, 600, 16);
+}
+
+BootScene* BootScene::create(double launchStartMs) {
+    BootScene* pRet = new BootScene();
+    if (pRet) pRet->_launchStartMs = launchStartMs;
+    if (pRet && pRet->init()) { pRet->autorelease(); return pRet; }
+    delete pRet; return nullptr;
+}
+
+BootScene::BootScene()
+    : _launchStartMs(0)
+    , _texturesReadyMs(0)
+    , _dealReadyMs(0)
+    , _facesReadyMs(0)
+    , _texturesLoaded(false)
+    , _dealReady(false)
+    , _facesReady(false)
+    , _started(false)
+    , _switched(false)
+    , _engine(nullptr)
+    , _progressBar(nullptr)
+{
+}
+
+BootScene::~BootScene() {
+    if (_dealThread.joinable()) _dealThread.join();
+    delete _engine; // 未交给 GameScene 时由这里释放
+}
+
+bool BootScene::init() {
+    if (!Scene::init()) return false;
+
+    // 与 GameScene 同色的底色和一条进度条，不创建文字，避免首帧前的字体渲染
+    auto bg = LayerColor::create(Color4B{10, 18, 30, 255});
+    addChild(bg, -2);
+
+    auto track = DrawNode::create();
+    track->drawSolidRect(PROGRESS_RECT.origin, Vec2(PROGRESS_RECT.getMaxX(), PROGRESS_RECT.getMaxY()),
+        Color4F(0.10f, 0.16f, 0.28f, 1.0f));
+    addChild(track);
+
+    _progressBar = DrawNode::create();
+    addChild(_progressBar);
+    return true;
+}
+
+void BootScene::onEnter() {
+    Scene::onEnter();
+    if (_started) return;
+    _started = true;
+
+    // 两个异步任务的回调都在主线程执行；完成前保持场景存活
+    retain();
+    CardFaceCache::preloadTexturesAsync([this](bool) {
+        onTexturesLoaded();
+        release();
+    });
+
+    retain();
+    _engine = new GameEngine();
+    GameEngine* engine = _engine;
+    _dealThread = std::thread([this, engine]() {
+        {
+            TRACE_THREAD_NAME("boot deal");
+            TRACE_SCOPE("BootScene::deal");
+            engine->newRandomGame(RandomService::makeEntropySeed());
+        }
+        Director::getInstance()->getScheduler()->performFunctionInCocosThread([this]() {
+            onDealReady();
+            release();
+        });
+    });
+
+    scheduleUpdate();
+}
+
+void BootScene::onTexturesLoaded() {
+    _texturesLoaded = true;
+    _texturesReadyMs = utils::getTimeInMilliseconds();
+    updateProgress();
+}
+
+void BootScene::onDealReady() {
+    _dealReady = true;
+    _dealReadyMs = utils::getTimeInMilliseconds();
+    updateProgress();
+}
+
+void BootScene::update(float dt) {
+    if (_switched) return;
+    FrameRateManager::getInstance()->keepAwake();
+
+    // 牌面合成要在主线程用渲染纹理绘制，纹理就绪后分帧进行，进度条保持刷新
+    if (_texturesLoaded && !_facesReady) {
+        TRACE_SCOPE("BootScene::warmUpFaces");
+        _facesReady = CardFaceCache::getInstance()->warmUpStep(FACES_PER_FRAME);
+        if (_facesReady) _facesReadyMs = utils::getTimeInMilliseconds();
+        updateProgress();
+    }
+
+    if (_facesReady && _dealReady) switchToGame();
+}
+
+void BootScene::updateProgress() {
+    // 纹理与发牌各占一成，其余按已合成的牌面
+    float progress = (_texturesLoaded ? 0.1f : 0.0f) + (_dealReady ? 0.1f : 0.0f)
+        + (_texturesLoaded ? 0.8f * CardFaceCache::getInstance()->getWarmUpProgress() : 0.0f);
+    _progressBar->clear();
+    _progressBar->drawSolidRect(PROGRESS_RECT.origin,
+        Vec2(PROGRESS_RECT.getMinX() + PROGRESS_RECT.size.width * progress, PROGRESS_RECT.getMaxY()),
+        Color4F(0.86f, 0.78f, 0.47f, 1.0f));
+}
+
+void BootScene::switchToGame() {
+    _switched = true;
+    unscheduleUpdate();
+    if (_dealThread.joinable()) _dealThread.join();
+
+    GameScene* gameScene = nullptr;
+    {
+        TRACE_SCOPE("BootScene::createGameScene");
+        gameScene = GameScene::create(_engine);
+        if (gameScene) {
+            _engine = nullptr;
+        } else {
+            // 创建失败时引擎仍归本场景，由析构释放；退回由 GameScene 自己同步发牌
+            log("BootScene: GameScene::create with the prepared engine failed, falling back to a fresh deal");
+            gameScene = GameScene::create();
+        }
+    }
+    if (!gameScene) {
+        // 仍然失败时不停在启动场景：下一帧重新尝试
+        log("BootScene: GameScene::create failed, retrying next frame");
+        _switched = false;
+        scheduleUpdate();
+        return;
+    }
+
+    // GameScene 画完第一帧即为可交互：导演在本帧的更新之后切换场景，本帧渲染结束时记录
+    double launchStartMs = _launchStartMs;
+    float texturesMs = static_cast<float>(_texturesReadyMs - launchStartMs);
+    float dealMs = static_cast<float>(_dealReadyMs - launchStartMs);
+    float facesMs = static_cast<float>(_facesReadyMs - launchStartMs);
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    auto listener = std::make_shared<EventListenerCustom*>(nullptr);
+    *listener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW,
+        [listener, gameScene, launchStartMs, texturesMs, dealMs, facesMs](EventCustom*) {
+            if (Director::getInstance()->getRunningScene() != gameScene) return;
+            float interactiveMs = static_cast<float>(utils::getTimeInMilliseconds() - launchStartMs);
+            EVENT_LOG(VIEW_BOOT_INTERACTIVE, interactiveMs, texturesMs, dealMs, facesMs);
+            // 事件环会被后续操作覆盖，且 EVENT_LOG_LEVEL=0 时不记录：每次启动另输出一行到控制台
+            log("BootScene: interactive after %.0f ms (textures %.0f ms, deal %.0f ms, faces %.0f ms)",
+                interactiveMs, texturesMs, dealMs, facesMs);
+            Director::getInstance()->getEventDispatcher()->removeEventListener(*listener);
+        });
+
+    Director::getInstance()->replaceScene(gameScene);
+}
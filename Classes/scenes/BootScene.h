@@ -0,0 +1,52 @@
+#ifndef BOOT_SCENE_H
+#define BOOT_SCENE_H
+
+#include "cocos2d.h"
+#include <thread>
+
+class GameEngine;
+
+/**
+ * 启动场景
+ * 只有底色与进度条，第一帧即可显示。进入后同时进行：
+ *   - 卡牌素材纹理经 TextureCache::addImageAsync 在后台线程解码（CardFaceCache::preloadTexturesAsync）
+ *   - 第一局在后台线程发牌（GameEngine 不依赖 cocos）
+ * 纹理就绪后每帧预合成若干牌面，三者都完成后创建 GameScene 并切换。
+ * 从 applicationDidFinishLaunching 开始到 GameScene 第一帧画完记为可交互时间，每次启动写入事件日志。
+ */
+class BootScene : public cocos2d::Scene
+{
+public:
+    // launchStartMs 为 applicationDidFinishLaunching 开始时的 utils::getTimeInMilliseconds()
+    static BootScene* create(double launchStartMs);
+    BootScene();
+    virtual ~BootScene();
+
+    virtual bool init() override;
+    virtual void onEnter() override;
+    virtual void update(float dt) override;
+
+private:
+    static const int FACES_PER_FRAME = 8; // 每帧预合成的牌面数，约 7 帧合成完
+
+    void onTexturesLoaded();
+    void onDealReady();
+    void updateProgress();
+    void switchToGame();
+
+    double _launchStartMs;
+    double _texturesReadyMs;
+    double _dealReadyMs;
+    double _facesReadyMs;
+    bool _texturesLoaded;
+    bool _dealReady;
+    bool _facesReady;
+    bool _started;
+    bool _switched;
+
+    GameEngine* _engine;      // 后台线程发牌用，切换时交给 GameScene
+    std::thread _dealThread;
+    cocos2d::DrawNode* _progressBar;
+};
+
+#endif
@@ -1,12 +1,20 @@
 #include "GameScene.h"
 #include "../controllers/GameController.h"
+#include "../utils/Trace.h"
 #include "ui/CocosGUI.h"
 
 USING_NS_CC;
 using namespace ui;
 
-GameScene* GameScene::create() {
+namespace {
+    const Rect TITLE_TAP_RECT(0, 1990, 260, 90);  // 标题文字所在区域
+    const double TITLE_TAP_INTERVAL_MS = 400.0;   // 连点的最大间隔
+    const int TITLE_TAP_TOGGLE_COUNT = 3;
+}
+
+GameScene* GameScene::create(GameEngine* preparedEngine) {
     GameScene* pRet = new GameScene();
+    if (pRet) pRet->_preparedEngine = preparedEngine;
     if (pRet && pRet->init()) { pRet->autorelease(); return pRet; }
     delete pRet; return nullptr;
 }
@@ -18,7 +26,12 @@ bool GameScene::init() {
     addChild(bg, -2);
 
     _gameController = new GameController();
-    _gameController->startGame(1);
+    if (_preparedEngine) {
+        _gameController->startPreparedGame(_preparedEngine);
+        _preparedEngine = nullptr;
+    } else {
+        _gameController->startGame(1);
+    }
 
     _gameController->setScoreCallback([this](int pts) {
         showScorePopup(pts);
@@ -31,6 +44,12 @@ bool GameScene::init() {
     if (_gameController->getGameView()) addChild(_gameController->getGameView());
 
     createUI();
+
+    _perfOverlay = PerfOverlay::create();
+    _perfOverlay->setPosition(Vec2(20, 1640));
+    addChild(_perfOverlay, 100);
+    _gameController->setModelCommittedCallback([this]() { _perfOverlay->markModelUpdate(); });
+    setupPerfOverlayToggle();
     updateScoreDisplay(0);
     updateStackCount(49);
     updateComboDisplay(0);
@@ -151,6 +170,33 @@ void GameScene::createUI() {
     addChild(tipLabel, 11);
 }
 
+void GameScene::setupPerfOverlayToggle() {
+    _lastTitleTapMs = -1.0;
+    _titleTapCount = 0;
+
+    // 不吞没触摸，标题栏上的按钮照常响应
+    auto touchListener = EventListenerTouchOneByOne::create();
+    touchListener->setSwallowTouches(false);
+    touchListener->onTouchBegan = [this](Touch* touch, Event*) {
+        if (!TITLE_TAP_RECT.containsPoint(convertToNodeSpace(touch->getLocation()))) return false;
+        double now = utils::getTimeInMilliseconds();
+        _titleTapCount = (_lastTitleTapMs >= 0 && now - _lastTitleTapMs <= TITLE_TAP_INTERVAL_MS) ? _titleTapCount + 1 : 1;
+        _lastTitleTapMs = now;
+        if (_titleTapCount >= TITLE_TAP_TOGGLE_COUNT) {
+            _titleTapCount = 0;
+            _perfOverlay->toggle();
+        }
+        return false;
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(touchListener, this);
+
+    auto keyListener = EventListenerKeyboard::create();
+    keyListener->onKeyReleased = [this](EventKeyboard::KeyCode key, Event*) {
+        if (key == EventKeyboard::KeyCode::KEY_F3) _perfOverlay->toggle();
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(keyListener, this);
+}
+
 void GameScene::onUndoButtonClicked() {
     if (_gameController) {
         _gameController->handleUndo();
@@ -171,6 +217,7 @@ void GameScene::onRestartButtonClicked() {
 }
 
 void GameScene::updateScoreDisplay(int score) {
+    TRACE_SCOPE("GameScene::updateScoreDisplay");
     if (_scoreLabel) {
         char buf[16]; sprintf(buf, "%d", score);
         _scoreLabel->setString(buf);
@@ -181,6 +228,7 @@ void GameScene::updateScoreDisplay(int score) {
 
 void GameScene::updateComboDisplay(int combo) {
     if (!_comboLabel) return;
+    TRACE_SCOPE("GameScene::updateComboDisplay");
     if (combo >= 2) {
         char buf[32]; sprintf(buf, "COMBO x%d !", combo);
         _comboLabel->setString(buf);
@@ -201,6 +249,7 @@ void GameScene::updateStackCount(int count) {
 }
 
 void GameScene::showScorePopup(int points) {
+    TRACE_SCOPE_VALUE("GameScene::showScorePopup", points);
     char txt[8];
     if (points >= 0) sprintf(txt, "+%d", points);
     else sprintf(txt, "%d", points);
@@ -3,15 +3,22 @@
 
 #include "cocos2d.h"
 #include "../controllers/GameController.h"
+#include "../views/PerfOverlay.h"
 
 class GameScene : public cocos2d::Scene
 {
 public:
-    static GameScene* create();
+    /**
+     * @param preparedEngine 已发好第一局的引擎（启动场景在后台线程准备），创建成功时由场景的控制器接管，
+     *                       返回空时所有权仍归调用方；为空时在 init 中同步发牌
+     */
+    static GameScene* create(GameEngine* preparedEngine = nullptr);
     virtual bool init() override;
 
 private:
     void createUI();
+    // 性能浮层的开关：连点标题三下，桌面平台另可按 F3
+    void setupPerfOverlayToggle();
     void onUndoButtonClicked();
     void onRestartButtonClicked();
     void updateScoreDisplay(int score);
@@ -20,10 +27,14 @@ private:
     void showScorePopup(int points);
     void showGameEnd(bool won);
 
+    GameEngine* _preparedEngine;
     GameController* _gameController;
     cocos2d::Label* _scoreLabel;
     cocos2d::Label* _comboLabel;
     cocos2d::Label* _stackCountLabel;
+    PerfOverlay* _perfOverlay;
+    double _lastTitleTapMs;
+    int _titleTapCount;
 };
 
 #endif
@@ -1,21 +0,0 @@
-#ifndef CARD_GENERATOR_SERVICE_H
-#define CARD_GENERATOR_SERVICE_H
-
-#include "../models/CardModel.h"
-#include "../models/CardTypes.h"
-
-class CardGeneratorService
-{
-public:
-    // 
-    static std::vector<CardModel*> generateRandomCards(int count);
-
-    // ضλõ
-    static std::vector<CardModel*> generateRandomCardsAtPosition(int count, const cocos2d::Vec2& position);
-
-private:
-    static CardFaceType getRandomFace();
-    static CardSuitType getRandomSuit();
-};
-
-#endif // CARD_GENERATOR_SERVICE_H
\ No newline at end of file
@@ -1,22 +0,0 @@
-#ifndef CARD_SERVICE_H
-#define CARD_SERVICE_H
-
-#include "../models/CardModel.h"
-
-class CardService
-{
-public:
-    static bool canMatch(const CardModel* card1, const CardModel* card2);
-    static std::string getFaceString(CardFaceType face);
-    static CardModel* findTopCard(const std::vector<CardModel*>& cards);
-    static int generateCardId();
-
-    // ɷ
-    static CardModel* generateRandomCard();
-    static CardModel* generateRandomCardAtPosition(const cocos2d::Vec2& position);
-
-private:
-    static int _nextCardId;
-};
-
-#endif
\ No newline at end of file
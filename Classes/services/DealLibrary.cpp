@@ -0,0 +1,170 @@
+#include "DealLibrary.h"
+#include "GameModelGenerator.h"
+#include "MatchRules.h"
+#include "RandomService.h"
+#include "../utils/CoreLog.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+    const char DEAL_MAGIC[4] = { 'D', 'E', 'A', 'L' };
+
+    // 每批写盘的局数上限，约 64MB（标准 64 字节记录时为 1M 局）
+    const size_t BATCH_BYTES = 64u << 20;
+
+    void storeSeed(uint8_t* dst, uint64_t seed)
+    {
+        for (int i = 0; i < 8; i++) {
+            dst[i] = static_cast<uint8_t>(seed >> (i * 8));
+        }
+    }
+
+    uint64_t loadSeed(const uint8_t* src)
+    {
+        uint64_t seed = 0;
+        for (int i = 0; i < 8; i++) {
+            seed |= static_cast<uint64_t>(src[i]) << (i * 8);
+        }
+        return seed;
+    }
+}
+
+DealLibrary::DealLibrary()
+{
+    std::memset(&_header, 0, sizeof(_header));
+}
+
+bool DealLibrary::open(const std::string& path)
+{
+    close();
+    if (!_file.open(path)) {
+        CORE_LOG("DealLibrary: cannot map %s", path.c_str());
+        return false;
+    }
+    if (_file.size() < HEADER_SIZE) {
+        close();
+        return false;
+    }
+
+    DealLibraryHeader header;
+    std::memcpy(&header, _file.data(), sizeof(header));
+    bool valid = std::memcmp(header.magic, DEAL_MAGIC, sizeof(DEAL_MAGIC)) == 0
+        && header.version == VERSION
+        && header.cardsPerDeal > 0
+        && header.recordSize == recordSizeFor(header.cardsPerDeal)
+        && header.dealCount <= (_file.size() - HEADER_SIZE) / header.recordSize;
+    if (!valid) {
+        CORE_LOG("DealLibrary: invalid header in %s", path.c_str());
+        close();
+        return false;
+    }
+
+    _header = header;
+    return true;
+}
+
+void DealLibrary::close()
+{
+    _file.close();
+    std::memset(&_header, 0, sizeof(_header));
+}
+
+const uint8_t* DealLibrary::recordAt(uint64_t index) const
+{
+    if (!_file.isOpen() || index >= _header.dealCount) return nullptr;
+    return _file.data() + HEADER_SIZE + index * _header.recordSize;
+}
+
+uint64_t DealLibrary::getDealSeed(uint64_t index) const
+{
+    const uint8_t* record = recordAt(index);
+    return record ? loadSeed(record) : 0;
+}
+
+const uint8_t* DealLibrary::getDealCards(uint64_t index) const
+{
+    const uint8_t* record = recordAt(index);
+    if (!record) return nullptr;
+    // 每个字节是牌种下标，取局时逐字节校验，损坏的记录不交给模型
+    const uint8_t* cards = record + SEED_SIZE;
+    for (int i = 0; i < _header.cardsPerDeal; i++) {
+        if (cards[i] >= MatchRules::KIND_COUNT) {
+            CORE_LOG("DealLibrary: deal %llu has invalid card byte %u", (unsigned long long)index, cards[i]);
+            return nullptr;
+        }
+    }
+    return cards;
+}
+
+uint32_t DealLibrary::recordSizeFor(int cardsPerDeal)
+{
+    return (SEED_SIZE + static_cast<uint32_t>(cardsPerDeal) + 7u) & ~7u;
+}
+
+void DealLibrary::encodeDeal(uint64_t baseSeed, uint64_t index, int cardsPerDeal, uint8_t* record)
+{
+    uint64_t seed = RandomService::deriveSeed(baseSeed, index);
+    storeSeed(record, seed);
+    GameModelGenerator::generateDealCards(seed, cardsPerDeal, record + SEED_SIZE);
+    // 补齐字节清零，保证同参数生成的文件逐字节一致
+    uint32_t used = SEED_SIZE + static_cast<uint32_t>(cardsPerDeal);
+    std::memset(record + used, 0, recordSizeFor(cardsPerDeal) - used);
+}
+
+bool DealLibrary::build(const std::string& path, uint64_t baseSeed, uint64_t dealCount,
+    int cardsPerDeal, int threadCount, const ProgressCallback& progress)
+{
+    if (cardsPerDeal <= 0 || cardsPerDeal > 0xFFFF) return false;
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    const uint32_t recordSize = recordSizeFor(cardsPerDeal);
+    const uint64_t batchDeals = std::max<uint64_t>(1, BATCH_BYTES / recordSize);
+
+    FILE* fp = std::fopen(path.c_str(), "wb");
+    if (!fp) return false;
+
+    DealLibraryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, DEAL_MAGIC, sizeof(DEAL_MAGIC));
+    header.version = VERSION;
+    header.cardsPerDeal = static_cast<uint16_t>(cardsPerDeal);
+    header.recordSize = recordSize;
+    header.dealCount = dealCount;
+    header.baseSeed = baseSeed;
+    bool ok = std::fwrite(&header, sizeof(header), 1, fp) == 1;
+
+    std::vector<uint8_t> batch;
+    std::vector<std::thread> workers;
+    for (uint64_t first = 0; ok && first < dealCount; first += batchDeals) {
+        const uint64_t count = std::min(batchDeals, dealCount - first);
+        batch.resize(static_cast<size_t>(count * recordSize));
+        uint8_t* batchData = batch.data();
+
+        // 每个线程负责批内连续的一段局号，互不共享写入位置
+        const uint64_t perThread = (count + threadCount - 1) / threadCount;
+        workers.clear();
+        for (int t = 0; t < threadCount; t++) {
+            const uint64_t begin = t * perThread;
+            const uint64_t end = std::min(count, begin + perThread);
+            if (begin >= end) break;
+            workers.emplace_back([=]() {
+                for (uint64_t i = begin; i < end; i++) {
+                    encodeDeal(baseSeed, first + i, cardsPerDeal, batchData + i * recordSize);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        ok = std::fwrite(batchData, 1, batch.size(), fp) == batch.size();
+        if (ok && progress) progress(first + count, dealCount);
+    }
+
+    ok = (std::fclose(fp) == 0) && ok;
+    if (!ok) std::remove(path.c_str());
+    return ok;
+}
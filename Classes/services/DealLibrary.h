@@ -0,0 +1,88 @@
+#pragma once
+#ifndef DEAL_LIBRARY_H
+#define DEAL_LIBRARY_H
+
+#include "../utils/MappedFile.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * 牌局库
+ * 大量可复现牌局的定长记录二进制文件，供每日挑战、比赛与 QA 回归集按编号随机访问。
+ *
+ * 文件布局（小端）：
+ *   [0, 64)   文件头 DealLibraryHeader
+ *   [64, ...) dealCount 条定长记录，第 i 条位于 64 + i * recordSize
+ * 每条记录：8 字节种子 + cardsPerDeal 字节牌面编码（见 GameModelGenerator::generateDealCards），
+ * 补齐到 8 字节；标准 56 张一局恰好 64 字节，一局一个缓存行。
+ * 第 i 局的种子为 RandomService::deriveSeed(baseSeed, i)，因此任一局也可脱离文件单独重算。
+ */
+struct DealLibraryHeader
+{
+    char magic[4];          // "DEAL"
+    uint16_t version;
+    uint16_t cardsPerDeal;
+    uint32_t recordSize;
+    uint32_t reserved;
+    uint64_t dealCount;
+    uint64_t baseSeed;
+    uint8_t padding[32];
+};
+
+static_assert(sizeof(DealLibraryHeader) == 64, "DealLibraryHeader must stay 64 bytes");
+
+class DealLibrary
+{
+public:
+    static const uint16_t VERSION = 1;
+    static const uint32_t HEADER_SIZE = 64;
+    static const uint32_t SEED_SIZE = 8;
+
+    // 进度回调：已写入局数 / 总局数
+    typedef std::function<void(uint64_t written, uint64_t total)> ProgressCallback;
+
+    DealLibrary();
+    ~DealLibrary() = default;
+
+    /**
+     * 映射牌局库文件
+     * @return 文件缺失、头部非法或长度与记录数不符时返回 false
+     */
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return _file.isOpen(); }
+
+    uint64_t getDealCount() const { return _header.dealCount; }
+    int getCardsPerDeal() const { return _header.cardsPerDeal; }
+    uint64_t getBaseSeed() const { return _header.baseSeed; }
+
+    // 第 index 局的种子，index 越界时返回 0
+    uint64_t getDealSeed(uint64_t index) const;
+
+    // 第 index 局的牌面编码（getCardsPerDeal() 字节，直接指向映射内存），越界或含无效牌种时返回 nullptr
+    const uint8_t* getDealCards(uint64_t index) const;
+
+    /**
+     * 批量生成牌局库，使用全部 CPU 核心
+     * 各线程按局号分段并行发牌，主线程按批顺序写盘；输出只取决于参数，与线程数无关。
+     * @param threadCount 工作线程数，0 表示取硬件并发数
+     * @return 参数非法或写文件失败时返回 false
+     */
+    static bool build(const std::string& path, uint64_t baseSeed, uint64_t dealCount,
+        int cardsPerDeal, int threadCount = 0, const ProgressCallback& progress = nullptr);
+
+    // 每局记录的字节数
+    static uint32_t recordSizeFor(int cardsPerDeal);
+
+    // 把第 index 局写入 record（recordSizeFor 字节）
+    static void encodeDeal(uint64_t baseSeed, uint64_t index, int cardsPerDeal, uint8_t* record);
+
+private:
+    const uint8_t* recordAt(uint64_t index) const;
+
+    MappedFile _file;
+    DealLibraryHeader _header;
+};
+
+#endif // DEAL_LIBRARY_H
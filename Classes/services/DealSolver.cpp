@@ -0,0 +1,579 @@
+#include "DealSolver.h"
+#include "MatchRules.h"
+#include "RandomService.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+    const int KIND_COUNT = MatchRules::KIND_COUNT;
+    const int MAX_SLOTS = 64;             // 桌面牌数上限（关卡可多于随机局的 6 张）
+    const int MOVE_NONE = 0xFF;           // 置换表中的最佳操作：就此停止
+    const int MOVE_DRAW = 0xFE;           // 抽牌；其余取值为要点击的牌种类
+    const int FRONTIER_TASKS_PER_THREAD = 8;
+    const int FRONTIER_MAX_DEPTH = 4;
+    const int NODE_FLUSH_INTERVAL = 1024; // 线程本地节点计数的汇总间隔
+
+    const uint64_t QUEUE_BASE = 0x9E3779B97F4A7C15ull; // 牌堆多项式散列的底数（奇数，模 2^64 可逆）
+
+    uint64_t inverseOf(uint64_t odd)
+    {
+        // 牛顿迭代求模 2^64 的逆元，每轮有效位数翻倍
+        uint64_t inv = odd;
+        for (int i = 0; i < 6; i++) inv *= 2 - odd * inv;
+        return inv;
+    }
+
+    int bitCount(uint64_t x)
+    {
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<int>((x * 0x0101010101010101ull) >> 56);
+    }
+
+    uint64_t mix64(uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * 求解用的静态表：牌种等价类与 Zobrist 键，进程内只生成一次，种子固定
+     */
+    struct SolverTables
+    {
+        uint8_t kindClass[KIND_COUNT];   // 匹配规则下等价牌种的代表
+        uint64_t playFieldKeys[KIND_COUNT];
+        uint64_t bottomKeys[KIND_COUNT + 1]; // 末项为无底牌
+        uint64_t queueKeys[KIND_COUNT];
+        uint64_t depthKeys[DealSolver::MAX_HORIZON + 1];
+        uint64_t queueBaseInverse;
+
+        SolverTables()
+        {
+            for (int k = 0; k < KIND_COUNT; k++) {
+                kindClass[k] = static_cast<uint8_t>(k);
+                for (int other = 0; other < k; other++) {
+                    if (GameMatchTable::kindMask(other) == GameMatchTable::kindMask(k)) {
+                        kindClass[k] = static_cast<uint8_t>(other);
+                        break;
+                    }
+                }
+            }
+            RandomService random(0x5EED5017u);
+            for (int k = 0; k < KIND_COUNT; k++) {
+                playFieldKeys[k] = random.next();
+                bottomKeys[k] = random.next();
+                queueKeys[k] = random.next() | 1u;
+            }
+            bottomKeys[KIND_COUNT] = random.next();
+            for (int d = 0; d <= DealSolver::MAX_HORIZON; d++) {
+                depthKeys[d] = random.next();
+            }
+            queueBaseInverse = inverseOf(QUEUE_BASE);
+        }
+    };
+
+    const SolverTables& tables()
+    {
+        static const SolverTables s_tables;
+        return s_tables;
+    }
+}
+
+/**
+ * 搜索状态
+ * 牌堆按入队序号存放在环形数组里：旧底牌从队首（牌堆底）进入，抽牌与补位从队尾（牌堆顶）取出。
+ * 牌堆散列 Q = Σ queueKeys[class] * B^seq，除以 B^head 后与牌堆在数组中的偏移无关，
+ * 入队出队都是 O(1) 更新。
+ */
+struct DealSolver::SearchContext
+{
+    int slotCount = 0;
+    uint8_t slotKind[MAX_SLOTS];
+    uint16_t slotCard[MAX_SLOTS];
+    uint8_t kindCounts[KIND_COUNT];
+    uint64_t playFieldMask = 0;  // 桌面已有牌种集合
+    uint64_t playFieldHash = 0;  // 桌面牌种类多重集合的散列（各牌加和）
+
+    int bottomKind = -1;
+    uint16_t bottomCard = 0;
+
+    std::vector<uint8_t> queueKind;
+    std::vector<uint16_t> queueCard;
+    uint32_t queueMask = 0;
+    uint32_t head = 0;           // 下一张出队（牌堆顶）的序号
+    uint32_t tail = 0;           // 下一张入队（牌堆底）的序号
+    uint64_t queueHash = 0;
+    uint64_t headPower = 1;      // B^head
+    uint64_t headInverse = 1;    // B^-head
+    uint64_t tailPower = 1;      // B^tail
+
+    int combo = 0;
+    uint64_t localNodes = 0;
+    ScoringRules scoring;
+
+    bool queueEmpty() const { return head == tail; }
+
+    bool hasMatch() const
+    {
+        return bottomKind >= 0 && (playFieldMask & GameMatchTable::kindMask(bottomKind)) != 0;
+    }
+
+    uint64_t key(int depth) const
+    {
+        const SolverTables& t = tables();
+        uint64_t bottomKey = t.bottomKeys[bottomKind >= 0 ? t.kindClass[bottomKind] : KIND_COUNT];
+        return playFieldHash ^ bottomKey ^ mix64(queueHash * headInverse)
+            ^ mix64(static_cast<uint64_t>(combo)) ^ t.depthKeys[depth];
+    }
+
+    void addToPlayField(int slot, uint8_t kind, uint16_t card)
+    {
+        slotKind[slot] = kind;
+        slotCard[slot] = card;
+        if (kindCounts[kind]++ == 0) playFieldMask |= uint64_t(1) << kind;
+        playFieldHash += tables().playFieldKeys[tables().kindClass[kind]];
+    }
+
+    void removeFromPlayField(int slot)
+    {
+        uint8_t kind = slotKind[slot];
+        if (--kindCounts[kind] == 0) playFieldMask &= ~(uint64_t(1) << kind);
+        playFieldHash -= tables().playFieldKeys[tables().kindClass[kind]];
+    }
+
+    void pushQueue(uint8_t kind, uint16_t card)
+    {
+        queueKind[tail & queueMask] = kind;
+        queueCard[tail & queueMask] = card;
+        queueHash += tables().queueKeys[tables().kindClass[kind]] * tailPower;
+        tailPower *= QUEUE_BASE;
+        tail++;
+    }
+
+    void popQueue(uint8_t& kind, uint16_t& card)
+    {
+        kind = queueKind[head & queueMask];
+        card = queueCard[head & queueMask];
+        queueHash -= tables().queueKeys[tables().kindClass[kind]] * headPower;
+        headPower *= QUEUE_BASE;
+        headInverse *= tables().queueBaseInverse;
+        head++;
+    }
+};
+
+namespace {
+    // 撤销一步所需的全部标量，整体保存、整体恢复
+    struct SavedState
+    {
+        uint64_t playFieldMask;
+        uint64_t playFieldHash;
+        int bottomKind;
+        uint16_t bottomCard;
+        uint32_t head;
+        uint32_t tail;
+        uint64_t queueHash;
+        uint64_t headPower;
+        uint64_t headInverse;
+        uint64_t tailPower;
+        int combo;
+    };
+
+    template <typename Context>
+    void saveState(const Context& ctx, SavedState& saved)
+    {
+        saved.playFieldMask = ctx.playFieldMask;
+        saved.playFieldHash = ctx.playFieldHash;
+        saved.bottomKind = ctx.bottomKind;
+        saved.bottomCard = ctx.bottomCard;
+        saved.head = ctx.head;
+        saved.tail = ctx.tail;
+        saved.queueHash = ctx.queueHash;
+        saved.headPower = ctx.headPower;
+        saved.headInverse = ctx.headInverse;
+        saved.tailPower = ctx.tailPower;
+        saved.combo = ctx.combo;
+    }
+
+    template <typename Context>
+    void restoreState(Context& ctx, const SavedState& saved)
+    {
+        ctx.playFieldMask = saved.playFieldMask;
+        ctx.playFieldHash = saved.playFieldHash;
+        ctx.bottomKind = saved.bottomKind;
+        ctx.bottomCard = saved.bottomCard;
+        ctx.head = saved.head;
+        ctx.tail = saved.tail;
+        ctx.queueHash = saved.queueHash;
+        ctx.headPower = saved.headPower;
+        ctx.headInverse = saved.headInverse;
+        ctx.tailPower = saved.tailPower;
+        ctx.combo = saved.combo;
+    }
+
+    /**
+     * 点击桌面第 slot 张牌：旧底牌入牌堆底，牌堆顶补到空位，被点击的牌成为底牌
+     * 旧底牌先入队，因此补位牌总是存在（牌堆原本为空时补回的就是旧底牌）
+     * @return 本步得分
+     */
+    template <typename Context>
+    int applyMatch(Context& ctx, int slot)
+    {
+        uint8_t clickedKind = ctx.slotKind[slot];
+        uint16_t clickedCard = ctx.slotCard[slot];
+        ctx.removeFromPlayField(slot);
+        ctx.pushQueue(static_cast<uint8_t>(ctx.bottomKind), ctx.bottomCard);
+        uint8_t refillKind;
+        uint16_t refillCard;
+        ctx.popQueue(refillKind, refillCard);
+        ctx.addToPlayField(slot, refillKind, refillCard);
+        ctx.bottomKind = clickedKind;
+        ctx.bottomCard = clickedCard;
+        ctx.combo++;
+        return ctx.scoring.matchScore(ctx.combo);
+    }
+
+    // 撤销 applyMatch：桌面牌种计数逐项还原，其余标量由 saved 整体恢复
+    template <typename Context>
+    void undoMatch(Context& ctx, int slot, uint8_t clickedKind, uint16_t clickedCard, const SavedState& saved)
+    {
+        ctx.kindCounts[ctx.slotKind[slot]]--;
+        ctx.kindCounts[clickedKind]++;
+        ctx.slotKind[slot] = clickedKind;
+        ctx.slotCard[slot] = clickedCard;
+        restoreState(ctx, saved);
+    }
+
+    // 抽牌：牌堆顶成为底牌，旧底牌入牌堆底；返回本步得分（罚分为负）
+    template <typename Context>
+    int applyDraw(Context& ctx)
+    {
+        int score = ctx.hasMatch() ? ctx.scoring.drawPenalty : 0;
+        uint8_t drawnKind;
+        uint16_t drawnCard;
+        ctx.popQueue(drawnKind, drawnCard);
+        if (ctx.bottomKind >= 0) ctx.pushQueue(static_cast<uint8_t>(ctx.bottomKind), ctx.bottomCard);
+        ctx.bottomKind = drawnKind;
+        ctx.bottomCard = drawnCard;
+        ctx.combo = 0;
+        return score;
+    }
+
+    /**
+     * 当前可点击的桌面牌，每个牌种类只取一张（同类的牌对后续局面完全等价），
+     * 按“成为底牌后桌面上还有几张可接的牌”从多到少排序，先搜连击潜力大的分支
+     */
+    template <typename Context>
+    int generateMatches(const Context& ctx, int* outSlots)
+    {
+        if (ctx.bottomKind < 0) return 0;
+        const SolverTables& t = tables();
+        uint64_t matchMask = GameMatchTable::kindMask(ctx.bottomKind);
+        uint64_t seenClasses = 0;
+        int priorities[MAX_SLOTS];
+        int count = 0;
+        for (int i = 0; i < ctx.slotCount; i++) {
+            int kind = ctx.slotKind[i];
+            if (!((matchMask >> kind) & 1u)) continue;
+            uint64_t classBit = uint64_t(1) << t.kindClass[kind];
+            if (seenClasses & classBit) continue;
+            seenClasses |= classBit;
+
+            int priority = bitCount(ctx.playFieldMask & GameMatchTable::kindMask(kind));
+            int j = count++;
+            while (j > 0 && priorities[j - 1] < priority) {
+                outSlots[j] = outSlots[j - 1];
+                priorities[j] = priorities[j - 1];
+                j--;
+            }
+            outSlots[j] = i;
+            priorities[j] = priority;
+        }
+        return count;
+    }
+}
+
+DealSolver::DealSolver(int tableBits)
+    : _tableMask(0)
+    , _nodes(0)
+    , _aborted(false)
+    , _nodeLimit(0)
+    , _solveCount(0)
+    , _salt(0)
+    , _cancelFlag(nullptr)
+{
+    if (tableBits < 10) tableBits = 10;
+    if (tableBits > 30) tableBits = 30;
+    _table.reset(new TableEntry[size_t(1) << tableBits]);
+    _tableMask = (uint64_t(1) << tableBits) - 1;
+    clearTable();
+    tables();
+}
+
+DealSolver::~DealSolver()
+{
+}
+
+void DealSolver::clearTable()
+{
+    for (uint64_t i = 0; i <= _tableMask; i++) {
+        _table[i].check.store(0, std::memory_order_relaxed);
+        _table[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool DealSolver::probe(uint64_t key, int& value, int& bestMove, bool& win) const
+{
+    const TableEntry& entry = _table[key & _tableMask];
+    uint64_t data = entry.data.load(std::memory_order_relaxed);
+    uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != (key ^ _salt) || data == 0) return false;
+    value = static_cast<int32_t>(static_cast<uint32_t>(data));
+    bestMove = static_cast<int>((data >> 32) & 0xFF);
+    win = ((data >> 40) & 1u) != 0;
+    return true;
+}
+
+void DealSolver::store(uint64_t key, int value, int bestMove, bool win)
+{
+    // 第 41 位恒为 1，保证有效数据非零
+    uint64_t data = static_cast<uint32_t>(value)
+        | (static_cast<uint64_t>(bestMove & 0xFF) << 32)
+        | (static_cast<uint64_t>(win ? 1 : 0) << 40)
+        | (uint64_t(1) << 41);
+    TableEntry& entry = _table[key & _tableMask];
+    entry.data.store(data, std::memory_order_relaxed);
+    entry.check.store(key ^ _salt ^ data, std::memory_order_relaxed);
+}
+
+bool DealSolver::countNode(SearchContext& ctx)
+{
+    if (++ctx.localNodes < NODE_FLUSH_INTERVAL) return !_aborted.load(std::memory_order_relaxed);
+    uint64_t total = _nodes.fetch_add(ctx.localNodes, std::memory_order_relaxed) + ctx.localNodes;
+    ctx.localNodes = 0;
+    if ((_nodeLimit && total >= _nodeLimit) || (_cancelFlag && _cancelFlag->load(std::memory_order_relaxed))) {
+        _aborted.store(true, std::memory_order_relaxed);
+    }
+    return !_aborted.load(std::memory_order_relaxed);
+}
+
+int DealSolver::search(SearchContext& ctx, int depth, bool& win)
+{
+    bool hasMatch = ctx.hasMatch();
+    if (ctx.queueEmpty() && !hasMatch) {
+        win = true;
+        return 0;
+    }
+    win = false;
+    if (depth == 0) return 0;
+
+    uint64_t key = ctx.key(depth);
+    int value, bestMove;
+    if (probe(key, value, bestMove, win)) return value;
+    if (!countNode(ctx)) return 0;
+
+    // 视界内可以随时停下，因此最优值不小于 0
+    int best = 0;
+    bestMove = MOVE_NONE;
+    bool anyWin = false;
+
+    int slots[MAX_SLOTS];
+    int matchCount = generateMatches(ctx, slots);
+    for (int i = 0; i < matchCount; i++) {
+        int slot = slots[i];
+        uint8_t clickedKind = ctx.slotKind[slot];
+        uint16_t clickedCard = ctx.slotCard[slot];
+        SavedState saved;
+        saveState(ctx, saved);
+
+        int gain = applyMatch(ctx, slot);
+        bool childWin;
+        int total = gain + search(ctx, depth - 1, childWin);
+        undoMatch(ctx, slot, clickedKind, clickedCard, saved);
+
+        anyWin = anyWin || childWin;
+        if (total > best) {
+            best = total;
+            bestMove = tables().kindClass[clickedKind];
+        }
+    }
+
+    if (!ctx.queueEmpty()) {
+        SavedState saved;
+        saveState(ctx, saved);
+        int gain = applyDraw(ctx);
+        bool childWin;
+        int total = gain + search(ctx, depth - 1, childWin);
+        restoreState(ctx, saved);
+
+        anyWin = anyWin || childWin;
+        if (total > best) {
+            best = total;
+            bestMove = MOVE_DRAW;
+        }
+    }
+
+    win = anyWin;
+    // 被中止的子树结果不完整，不写入置换表
+    if (!_aborted.load(std::memory_order_relaxed)) store(key, best, bestMove, anyWin);
+    return best;
+}
+
+void DealSolver::searchFrontier(const SearchContext& root, int depth, int threadCount)
+{
+    // 逐层展开开局若干步，直到子局面足够分给全部线程
+    std::vector<SearchContext> frontier(1, root);
+    std::vector<SearchContext> next;
+    int frontierDepth = 0;
+    while (frontierDepth < FRONTIER_MAX_DEPTH && frontierDepth < depth - 1
+        && static_cast<int>(frontier.size()) < threadCount * FRONTIER_TASKS_PER_THREAD) {
+        next.clear();
+        for (const SearchContext& ctx : frontier) {
+            if (ctx.queueEmpty() && !ctx.hasMatch()) continue;
+            int slots[MAX_SLOTS];
+            int matchCount = generateMatches(ctx, slots);
+            for (int i = 0; i < matchCount; i++) {
+                next.push_back(ctx);
+                applyMatch(next.back(), slots[i]);
+            }
+            if (!ctx.queueEmpty()) {
+                next.push_back(ctx);
+                applyDraw(next.back());
+            }
+        }
+        if (next.empty()) return;
+        frontier.swap(next);
+        frontierDepth++;
+    }
+
+    std::atomic<size_t> nextTask(0);
+    const int childDepth = depth - frontierDepth;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&]() {
+            for (size_t i = nextTask.fetch_add(1); i < frontier.size(); i = nextTask.fetch_add(1)) {
+                bool win;
+                search(frontier[i], childDepth, win);
+                _nodes.fetch_add(frontier[i].localNodes, std::memory_order_relaxed);
+                frontier[i].localNodes = 0;
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+void DealSolver::extractMoves(SearchContext& ctx, int depth, std::vector<MoveRecord>& outMoves)
+{
+    // 沿置换表中的最佳操作前进；对应项被覆盖时重新搜索该局面（其子局面大多仍在表中）
+    for (; depth > 0; depth--) {
+        int value, bestMove;
+        bool win;
+        if (!probe(ctx.key(depth), value, bestMove, win)) {
+            search(ctx, depth, win);
+            if (!probe(ctx.key(depth), value, bestMove, win)) return;
+        }
+        if (bestMove == MOVE_NONE) return;
+
+        MoveRecord move = {};
+        if (bestMove == MOVE_DRAW) {
+            move.operationType = OperationType::DRAW_CARD;
+            applyDraw(ctx);
+            move.cardId = ctx.bottomCard;
+        } else {
+            int slot = -1;
+            for (int i = 0; i < ctx.slotCount && slot < 0; i++) {
+                if (tables().kindClass[ctx.slotKind[i]] == bestMove
+                    && GameMatchTable::canMatch(ctx.slotKind[i], ctx.bottomKind)) {
+                    slot = i;
+                }
+            }
+            if (slot < 0) return;
+            move.operationType = OperationType::CARD_MATCH;
+            move.cardId = ctx.slotCard[slot];
+            applyMatch(ctx, slot);
+        }
+        outMoves.push_back(move);
+    }
+}
+
+DealSolver::Result DealSolver::solve(const GameModel* gameModel, const Options& options)
+{
+    if (!gameModel) return Result();
+
+    TimelineManager::capture(gameModel, 0, _modelSnapshot);
+    _kindBuffer.resize(gameModel->getCardCount());
+    for (int i = 0; i < gameModel->getCardCount(); i++) {
+        _kindBuffer[i] = static_cast<uint8_t>(gameModel->getCardById(i)->getKindIndex());
+    }
+    return solve(_modelSnapshot, _kindBuffer.data(), gameModel->getCardCount(), options);
+}
+
+DealSolver::Result DealSolver::solve(const GameSnapshot& snapshot, const uint8_t* cardKinds, int cardCount,
+    const Options& options)
+{
+    Result result;
+    int depth = std::max(0, std::min(options.horizon, static_cast<int>(MAX_HORIZON)));
+    if (static_cast<int>(snapshot.playFieldCards.size()) > MAX_SLOTS) return result;
+
+    SearchContext root;
+    std::fill(root.kindCounts, root.kindCounts + KIND_COUNT, 0);
+    for (const GameSnapshot::PlayFieldCard& entry : snapshot.playFieldCards) {
+        if (entry.cardId >= cardCount) return result;
+        root.addToPlayField(root.slotCount++, cardKinds[entry.cardId], entry.cardId);
+    }
+    if (snapshot.bottomCardId < cardCount) {
+        root.bottomKind = cardKinds[snapshot.bottomCardId];
+        root.bottomCard = snapshot.bottomCardId;
+    }
+
+    // 牌堆容量覆盖视界内的全部入队，环形数组不会覆盖仍在牌堆中的牌
+    uint32_t capacity = 1;
+    while (capacity < static_cast<uint32_t>(snapshot.stackCards.size() + depth + 2)) capacity <<= 1;
+    root.queueKind.resize(capacity);
+    root.queueCard.resize(capacity);
+    root.queueMask = capacity - 1;
+    for (size_t i = snapshot.stackCards.size(); i > 0; i--) {
+        uint16_t cardId = snapshot.stackCards[i - 1];
+        if (cardId >= cardCount) return result;
+        root.pushQueue(cardKinds[cardId], cardId);
+    }
+    root.combo = snapshot.combo;
+    root.scoring = options.scoring;
+
+    // 每次求解换一个校验盐，上一次求解留下的项不会命中，无需清表；下标不受盐影响，结果与求解历史无关
+    _salt = mix64(++_solveCount);
+    _nodes.store(0);
+    _aborted.store(false);
+    _nodeLimit = options.nodeLimit;
+    _cancelFlag = options.cancelFlag;
+
+    int threadCount = options.threadCount;
+    if (threadCount <= 0) threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    if (threadCount > 1 && depth > 1) searchFrontier(root, depth, threadCount);
+
+    bool win;
+    int best = search(root, depth, win);
+    _nodes.fetch_add(root.localNodes);
+    root.localNodes = 0;
+
+    result.complete = !_aborted.load();
+    result.winnable = win;
+    result.bestScore = snapshot.score + best;
+    if (result.complete) extractMoves(root, depth, result.moves);
+    result.nodes = _nodes.load();
+    return result;
+}
+
+DealSolver::Result DealSolver::solveDeal(const uint8_t* cards, int totalCards, const Options& options)
+{
+    if (!cards) {
+        Result result;
+        result.complete = false;
+        return result;
+    }
+    _dealGenerator.generateGameModelFromDeal(&_dealModel, cards, totalCards);
+    return solve(&_dealModel, options);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#ifndef DEAL_SOLVER_H
+#define DEAL_SOLVER_H
+
+#include "../models/GameModel.h"
+#include "../models/TimelineModel.h"
+#include "../managers/TimelineManager.h"
+#include "../core/GameEngine.h"
+#include "GameModelGenerator.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * 牌局求解器
+ * 对牌面完全已知的一局做穷举搜索，规则与 GameEngine 一致：点击桌面牌与底牌匹配、
+ * 从牌堆抽牌替换底牌、匹配后牌堆顶补到空位、连击加分与抽牌罚分。
+ *
+ * 旧底牌总会回到牌堆，牌堆只在开局即为空时才会空，因此本局可能无限进行下去，
+ * 搜索限定在视界（最多 horizon 步）内：求视界内可达的最高得分（par）与对应的操作序列，
+ * 并判定视界内能否到达终局（牌堆空且无可匹配牌，即 GameEngine::isGameOver）。
+ *
+ * 搜索状态只保留规则相关的信息：桌面牌种的多重集合、底牌、牌堆顺序与连击数，
+ * 匹配规则下等价的牌种（如不分花色时同点数的牌）归为同一类，以增加置换命中。
+ * 状态以 Zobrist 散列（牌堆部分为可 O(1) 增量维护的多项式散列）作为置换表键，
+ * 置换表为无锁共享表（键与数据异或校验），多线程时各线程先并行求解开局若干层展开出的子局面，
+ * 再由主线程从根搜索，直接命中子局面结果。结果只取决于牌局与视界，与线程数无关。
+ */
+class DealSolver
+{
+public:
+    static const int DEFAULT_TABLE_BITS = 20; // 置换表 2^20 项，每项 16 字节
+    static const int DEFAULT_HORIZON = 20;    // 默认视界（步），标准局单线程平均约 4ms
+    static const int MAX_HORIZON = 255;
+
+    struct Options
+    {
+        int horizon = DEFAULT_HORIZON; // 最多考虑的操作步数
+        int threadCount = 1;           // 搜索线程数，0 表示取硬件并发数
+        uint64_t nodeLimit = 0;        // 搜索节点上限，0 表示不限
+        const std::atomic<bool>* cancelFlag = nullptr; // 其他线程置位后尽快中止，结果视同触及节点上限
+        ScoringRules scoring;          // 计分规则，须与重放序列的 GameEngine 一致
+    };
+
+    struct Result
+    {
+        bool winnable = false;          // 视界内能否到达终局
+        int bestScore = 0;              // 视界内可达的最高总分（含当前得分）
+        std::vector<MoveRecord> moves;  // 取得最高分的操作序列，可直接交给 GameEngine::applyMove 重放
+        uint64_t nodes = 0;             // 展开的搜索节点数
+        bool complete = true;           // 触及节点上限或被取消时为 false，此时 bestScore 只是可达下界且不给出序列
+    };
+
+    explicit DealSolver(int tableBits = DEFAULT_TABLE_BITS);
+    ~DealSolver();
+
+    DealSolver(const DealSolver&) = delete;
+    DealSolver& operator=(const DealSolver&) = delete;
+
+    /**
+     * 从当前牌面（可以是进行中的一局）开始求解
+     */
+    Result solve(const GameModel* gameModel, const Options& options);
+
+    /**
+     * 从检查点形式的牌面开始求解，不访问 GameModel，可在工作线程上处理主线程复制出的局面
+     * @param cardKinds 卡牌ID -> 牌种下标（suit * 13 + face）
+     */
+    Result solve(const GameSnapshot& snapshot, const uint8_t* cardKinds, int cardCount, const Options& options);
+
+    /**
+     * 求解牌面编码描述的一局（GameModelGenerator::generateDealCards 的输出或牌局库记录）
+     */
+    Result solveDeal(const uint8_t* cards, int totalCards, const Options& options);
+
+private:
+    struct SearchContext;
+
+    struct TableEntry
+    {
+        std::atomic<uint64_t> check; // key ^ salt ^ data，读到撕裂的项时校验失败，视为未命中
+        std::atomic<uint64_t> data;
+    };
+
+    void clearTable();
+    bool probe(uint64_t key, int& value, int& bestMove, bool& win) const;
+    void store(uint64_t key, int value, int bestMove, bool win);
+
+    int search(SearchContext& ctx, int depth, bool& win);
+    void searchFrontier(const SearchContext& root, int depth, int threadCount);
+    void extractMoves(SearchContext& ctx, int depth, std::vector<MoveRecord>& outMoves);
+    bool countNode(SearchContext& ctx);
+
+    std::unique_ptr<TableEntry[]> _table;
+    uint64_t _tableMask;
+    std::atomic<uint64_t> _nodes;
+    std::atomic<bool> _aborted;
+    uint64_t _nodeLimit;
+    uint64_t _solveCount;
+    uint64_t _salt;
+    const std::atomic<bool>* _cancelFlag;
+
+    GameModel _dealModel;              // solveDeal 的临时牌面
+    GameModelGenerator _dealGenerator;
+    GameSnapshot _modelSnapshot;       // solve(GameModel) 复制出的局面
+    std::vector<uint8_t> _kindBuffer;
+};
+
+#endif // DEAL_SOLVER_H
@@ -1,96 +1,98 @@
 #include "GameModelGenerator.h"
-#include "../utils/GameUtils.h"
-
-USING_NS_CC;
+#include "MatchRules.h"
 
 GameModelGenerator::GameModelGenerator() {}
 
-GameModel* GameModelGenerator::generateGameModel(LevelConfig* levelConfig)
+GameModel* GameModelGenerator::prepareGameModel(GameModel* gameModel)
+{
+    if (!gameModel) return new GameModel();
+    gameModel->reset();
+    return gameModel;
+}
+
+GameModel* GameModelGenerator::generateGameModel(LevelConfig* levelConfig, GameModel* gameModel)
 {
     if (!levelConfig) return nullptr;
-    GameModel* gameModel = new GameModel();
+    gameModel = prepareGameModel(gameModel);
 
-    std::vector<CardModel*> playFieldCards;
+    std::vector<CardModel*>& cards = _dealBuffer;
+    cards.clear();
     for (auto& cfg : levelConfig->getPlayFieldCards()) {
-        int cardId = GameUtils::generateCardId();
-        CardModel* cm = createCardModel(cfg, cardId);
-        if (cm) playFieldCards.push_back(cm);
+        CardModel* cm = createCardModel(gameModel, cfg);
+        if (cm) cards.push_back(cm);
     }
-    gameModel->setPlayFieldCards(playFieldCards);
+    gameModel->setPlayFieldCards(cards);
 
-    std::vector<CardModel*> stackCards;
+    cards.clear();
     for (auto& cfg : levelConfig->getStackCards()) {
-        int cardId = GameUtils::generateCardId();
-        CardModel* cm = createCardModel(cfg, cardId);
-        if (cm) stackCards.push_back(cm);
+        CardModel* cm = createCardModel(gameModel, cfg);
+        if (cm) cards.push_back(cm);
     }
-    gameModel->setStackCards(stackCards);
 
-    if (!stackCards.empty()) {
-        auto nsc = stackCards;
-        CardModel* ib = nsc.back(); nsc.pop_back();
+    if (!cards.empty()) {
+        CardModel* ib = cards.back(); cards.pop_back();
         gameModel->setBottomCard(ib);
-        gameModel->setStackCards(nsc);
     }
+    gameModel->setStackCards(cards);
     return gameModel;
 }
 
-GameModel* GameModelGenerator::generateRandomGameModel()
+GameModel* GameModelGenerator::generateRandomGameModel(GameModel* gameModel, uint64_t seed, int totalCards)
 {
-    GameModel* gameModel = new GameModel();
-    const int TOTAL_CARDS = 56;
-    const int PLAYFIELD_COUNT = 6;
+    if (totalCards < 0) totalCards = 0;
+    if (totalCards > MAX_TOTAL_CARDS) totalCards = MAX_TOTAL_CARDS;
+    _codeBuffer.resize(totalCards);
+    generateDealCards(seed, totalCards, _codeBuffer.data());
+    return generateGameModelFromDeal(gameModel, _codeBuffer.data(), totalCards);
+}
 
-    // 1. 生成56张随机牌
-    std::vector<CardModel*> allCards;
-    for (int i = 0; i < TOTAL_CARDS; i++) {
-        CardSuitType suit = static_cast<CardSuitType>(GameUtils::getRandomInt(0, 3));
-        CardFaceType face = static_cast<CardFaceType>(GameUtils::getRandomInt(0, 12));
-        int cardId = GameUtils::generateCardId();
-        CardModel* card = new CardModel();
-        card->setCardId(cardId);
-        card->setSuit(suit);
-        card->setFace(face);
-        card->setPosition(Vec2::ZERO);
-        card->setFlipped(false);
-        allCards.push_back(card);
+void GameModelGenerator::generateDealCards(uint64_t seed, int totalCards, uint8_t* outCards)
+{
+    RandomService random(seed);
+    // 每张牌的牌种独立均匀抽取，整体已是均匀排列，无需再洗牌
+    for (int i = 0; i < totalCards; i++) {
+        outCards[i] = static_cast<uint8_t>(random.nextBounded(MatchRules::KIND_COUNT));
     }
+}
 
-    // 2. 洗牌
-    shuffleVector(allCards);
+GameModel* GameModelGenerator::generateGameModelFromDeal(GameModel* gameModel, const uint8_t* cards, int totalCards)
+{
+    gameModel = prepareGameModel(gameModel);
+    if (totalCards > MAX_TOTAL_CARDS) totalCards = MAX_TOTAL_CARDS;
 
-    // 3. 桌面牌：3x2 居中紧凑
+    // 1. 桌面牌：3x2 居中紧凑
     float colPositions[2] = { 380.0f, 700.0f };
     float rowPositions[3] = { 1050.0f, 720.0f, 390.0f };
 
-    std::vector<CardModel*> playFieldCards;
-    for (int i = 0; i < PLAYFIELD_COUNT && !allCards.empty(); i++) {
-        CardModel* card = allCards.back(); allCards.pop_back();
+    int next = 0;
+    for (int i = 0; i < DEAL_PLAYFIELD_COUNT && next < totalCards; i++) {
         int col = i % 2;
         int row = i / 2;
-        card->setPosition(Vec2(colPositions[col], rowPositions[row]));
+        CardModel* card = createDealCardModel(gameModel, cards[next++], CardPosition(colPositions[col], rowPositions[row]));
         card->setFlipped(true);
-        playFieldCards.push_back(card);
+        gameModel->addCardToPlayField(card);
     }
-    gameModel->setPlayFieldCards(playFieldCards);
 
-    // 4. 底牌
-    if (!allCards.empty()) {
-        CardModel* btm = allCards.back(); allCards.pop_back();
-        btm->setPosition(Vec2::ZERO);
+    // 2. 底牌
+    if (next < totalCards) {
+        CardModel* btm = createDealCardModel(gameModel, cards[next++], CardPosition());
         btm->setFlipped(true);
         gameModel->setBottomCard(btm);
     }
 
-    // 5. 牌堆
-    gameModel->setStackCards(allCards);
+    // 3. 牌堆（由牌堆底到牌堆顶）
+    std::vector<CardModel*>& stackCards = _dealBuffer;
+    stackCards.clear();
+    while (next < totalCards) {
+        stackCards.push_back(createDealCardModel(gameModel, cards[next++], CardPosition()));
+    }
+    gameModel->setStackCards(stackCards);
     return gameModel;
 }
 
-CardModel* GameModelGenerator::createCardModel(const LevelConfig::CardConfig& cfg, int cardId)
+CardModel* GameModelGenerator::createCardModel(GameModel* gameModel, const LevelConfig::CardConfig& cfg)
 {
-    CardModel* cm = new CardModel();
-    cm->setCardId(cardId);
+    CardModel* cm = gameModel->createCard();
     cm->setFace(cfg.face);
     cm->setSuit(cfg.suit);
     cm->setPosition(cfg.position);
@@ -98,13 +100,12 @@ CardModel* GameModelGenerator::createCardModel(const LevelConfig::CardConfig& cf
     return cm;
 }
 
-CardModel* GameModelGenerator::createRandomCardModel(int cardId, const cocos2d::Vec2& pos)
+CardModel* GameModelGenerator::createDealCardModel(GameModel* gameModel, uint8_t kind, const CardPosition& pos)
 {
-    CardModel* cm = new CardModel();
-    cm->setCardId(cardId);
-    cm->setSuit(static_cast<CardSuitType>(GameUtils::getRandomInt(0, 3)));
-    cm->setFace(static_cast<CardFaceType>(GameUtils::getRandomInt(0, 12)));
+    CardModel* cm = gameModel->createCard();
+    cm->setSuit(static_cast<CardSuitType>(kind / MatchRules::FACE_COUNT));
+    cm->setFace(static_cast<CardFaceType>(kind % MatchRules::FACE_COUNT));
     cm->setPosition(pos);
-    cm->setFlipped(true);
+    cm->setFlipped(false);
     return cm;
 }
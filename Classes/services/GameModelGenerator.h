@@ -4,8 +4,8 @@
 
 #include "../models/GameModel.h"
 #include "../configs/models/LevelConfig.h"
-#include <algorithm>
-#include <cstdlib>
+#include "RandomService.h"
+#include <cstdint>
 
 /**
  * 游戏模型生成服务
@@ -13,26 +13,48 @@
 class GameModelGenerator
 {
 public:
+    static const int DEFAULT_TOTAL_CARDS = 56;    // 标准一局：6 张桌面牌 + 1 张底牌 + 49 张牌堆
+    static const int HUGE_SHOE_CARDS = 10240;     // 超大牌靴模式
+    static const int DEAL_PLAYFIELD_COUNT = 6;    // 随机局的桌面牌数（3x2）
+    static const int MAX_TOTAL_CARDS = 0xFFFF;    // 单局牌数上限，撤销记录以 16 位保存卡牌ID
+
     GameModelGenerator();
     ~GameModelGenerator() = default;
 
-    GameModel* generateGameModel(LevelConfig* levelConfig);
-    GameModel* generateRandomGameModel();
+    /**
+     * 生成一局游戏模型
+     * @param gameModel 传入已有模型时原地 reset 后重新发牌，复用其对象池与容器内存；
+     *                  传入 nullptr 时新建模型，由调用方负责 delete
+     */
+    GameModel* generateGameModel(LevelConfig* levelConfig, GameModel* gameModel = nullptr);
+
+    /**
+     * 随机发牌，发牌结果完全由 seed 决定
+     * @param seed 本局种子，相同种子与牌数必定得到相同的牌局
+     */
+    GameModel* generateRandomGameModel(GameModel* gameModel, uint64_t seed, int totalCards = DEFAULT_TOTAL_CARDS);
+
+    /**
+     * 只生成牌面编码，不创建任何 CardModel，供批量发牌与牌局库使用
+     * 每张牌编码为 1 字节的牌种下标 suit * 13 + face，按发牌顺序排列：
+     * [0, 6) 桌面牌，[6] 底牌，其余为牌堆（由牌堆底到牌堆顶）。
+     * generateRandomGameModel 同样经由此函数发牌，二者对同一种子结果一致。
+     * @param outCards 至少 totalCards 字节
+     */
+    static void generateDealCards(uint64_t seed, int totalCards, uint8_t* outCards);
+
+    /**
+     * 按牌面编码（generateDealCards 的输出或牌局库中的记录）构建游戏模型
+     */
+    GameModel* generateGameModelFromDeal(GameModel* gameModel, const uint8_t* cards, int totalCards);
 
 private:
-    CardModel* createCardModel(const LevelConfig::CardConfig& cardConfig, int cardId);
-    CardModel* createRandomCardModel(int cardId, const cocos2d::Vec2& position);
+    CardModel* createCardModel(GameModel* gameModel, const LevelConfig::CardConfig& cardConfig);
+    CardModel* createDealCardModel(GameModel* gameModel, uint8_t kind, const CardPosition& position);
+    GameModel* prepareGameModel(GameModel* gameModel);
 
-    template<typename T>
-    void shuffleVector(std::vector<T>& vec);
+    std::vector<CardModel*> _dealBuffer; // 发牌临时缓冲，跨局复用容量
+    std::vector<uint8_t> _codeBuffer;    // 随机局的牌面编码缓冲
 };
 
-template<typename T>
-void GameModelGenerator::shuffleVector(std::vector<T>& vec) {
-    for (size_t i = vec.size() - 1; i > 0; i--) {
-        size_t j = static_cast<size_t>(rand()) % (i + 1);
-        std::swap(vec[i], vec[j]);
-    }
-}
-
 #endif
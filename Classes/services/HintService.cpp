@@ -0,0 +1,140 @@
+#include "HintService.h"
+#include "../managers/TimelineManager.h"
+#include "../utils/CoreLog.h"
+#include "../utils/Trace.h"
+
+namespace {
+    uint64_t mixHash(uint64_t hash, uint64_t value)
+    {
+        hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+        return hash * 0xBF58476D1CE4E5B9ull;
+    }
+}
+
+HintService::HintService(const MainThreadDispatcher& dispatcher, int horizon)
+    : _dispatcher(dispatcher)
+    , _horizon(horizon)
+    , _currentKey(0)
+    , _aliveToken(std::make_shared<bool>(true))
+    , _hasPending(false)
+    , _stopping(false)
+    , _cancel(false)
+{
+    _worker = std::thread(&HintService::workerLoop, this);
+}
+
+HintService::~HintService()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _cancel = true;
+    }
+    _wakeup.notify_one();
+    _worker.join();
+}
+
+uint64_t HintService::hashSnapshot(const GameSnapshot& snapshot, const std::vector<uint8_t>& cardKinds)
+{
+    // 按卡牌ID与牌种散列：同一局内相同ID即同一张牌，换局后牌种不同的局面也不会混用缓存
+    uint64_t hash = mixHash(0, static_cast<uint64_t>(snapshot.combo));
+    hash = mixHash(hash, snapshot.bottomCardId);
+    for (const GameSnapshot::PlayFieldCard& entry : snapshot.playFieldCards) {
+        hash = mixHash(hash, entry.cardId | (static_cast<uint64_t>(cardKinds[entry.cardId]) << 16));
+    }
+    hash = mixHash(hash, 0xFFFFFFFFull);
+    for (uint16_t cardId : snapshot.stackCards) {
+        hash = mixHash(hash, cardId | (static_cast<uint64_t>(cardKinds[cardId]) << 16));
+    }
+    return hash;
+}
+
+void HintService::onStateChanged(const GameModel* gameModel)
+{
+    if (!gameModel) return;
+
+    TimelineManager::capture(gameModel, 0, _scratch.snapshot);
+    _scratch.cardKinds.resize(gameModel->getCardCount());
+    for (int i = 0; i < gameModel->getCardCount(); i++) {
+        _scratch.cardKinds[i] = static_cast<uint8_t>(gameModel->getCardById(i)->getKindIndex());
+    }
+    _scratch.stateKey = hashSnapshot(_scratch.snapshot, _scratch.cardKinds);
+    _currentKey = _scratch.stateKey;
+
+    auto cached = _cache.find(_currentKey);
+    if (cached != _cache.end()) {
+        // 命中缓存（如撤销回到之前的局面）：不必再搜索，进行中与排队中的搜索也已过时
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _hasPending = false;
+            _cancel = true;
+        }
+        if (_readyCallback) _readyCallback(cached->second);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::swap(_pending, _scratch);
+        _hasPending = true;
+        _cancel = true;
+    }
+    _wakeup.notify_one();
+}
+
+bool HintService::getHint(Hint& outHint) const
+{
+    auto cached = _cache.find(_currentKey);
+    if (cached == _cache.end()) return false;
+    outHint = cached->second;
+    return true;
+}
+
+void HintService::workerLoop()
+{
+    DealSolver solver(DEFAULT_TABLE_BITS);
+    Request request;
+    std::weak_ptr<bool> alive = _aliveToken;
+    TRACE_THREAD_NAME("HintService");
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeup.wait(lock, [this]() { return _hasPending || _stopping; });
+            if (_stopping) return;
+            std::swap(request, _pending);
+            _hasPending = false;
+            _cancel = false;
+        }
+
+        DealSolver::Options options;
+        options.horizon = _horizon;
+        options.cancelFlag = &_cancel;
+        TRACE_SCOPE("HintService::search");
+        DealSolver::Result result = solver.solve(request.snapshot, request.cardKinds.data(),
+            static_cast<int>(request.cardKinds.size()), options);
+        if (!result.complete) continue; // 已被新局面取消
+
+        Hint hint;
+        hint.expectedGain = result.bestScore - request.snapshot.score;
+        if (result.moves.empty() || result.moves[0].operationType == OperationType::DRAW_CARD) {
+            hint.draw = true;
+        } else {
+            hint.cardId = result.moves[0].cardId;
+        }
+
+        uint64_t stateKey = request.stateKey;
+        _dispatcher([this, alive, stateKey, hint]() {
+            // 回调在主线程执行，与析构同线程：令牌仍在即本对象仍在
+            if (alive.expired()) return;
+            deliver(stateKey, hint);
+        });
+    }
+}
+
+void HintService::deliver(uint64_t stateKey, const Hint& hint)
+{
+    if (_cache.size() >= MAX_CACHED_HINTS) _cache.clear();
+    _cache[stateKey] = hint;
+    if (stateKey == _currentKey && _readyCallback) _readyCallback(hint);
+}
@@ -0,0 +1,99 @@
+#pragma once
+#ifndef HINT_SERVICE_H
+#define HINT_SERVICE_H
+
+#include "DealSolver.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * 提示
+ */
+struct Hint
+{
+    bool draw = false;   // 建议抽牌
+    int cardId = -1;     // 建议点击的桌面牌，抽牌时为 -1
+    int expectedGain = 0; // 按建议走完视界可再得的分数
+};
+
+/**
+ * 后台提示服务
+ * 每次模型提交后由主线程调用 onStateChanged：复制出当前局面交给工作线程上的 DealSolver 搜索，
+ * 结果经由注入的派发函数回到主线程，按局面散列缓存；按下提示时直接查缓存，不在主线程上搜索。
+ * 新的局面到来时正在进行的搜索被取消，迟到的结果只写缓存，不会当作当前局面的提示。
+ * 不依赖 cocos2d-x：派发函数由调用方提供（客户端为 Scheduler::performFunctionInCocosThread）。
+ * 除构造函数中启动的工作线程外，全部接口只能在主线程调用。
+ */
+class HintService
+{
+public:
+    static const int DEFAULT_HORIZON = 12;    // 提示的搜索视界，标准局通常不到 1ms
+    static const int DEFAULT_TABLE_BITS = 16; // 置换表 2^16 项（1 MB），兼顾手机内存
+    static const int MAX_CACHED_HINTS = 4096;
+
+    // 把任务派发到主线程执行，可在任意线程调用
+    typedef std::function<void(const std::function<void()>&)> MainThreadDispatcher;
+    typedef std::function<void(const Hint&)> HintReadyCallback;
+
+    explicit HintService(const MainThreadDispatcher& dispatcher, int horizon = DEFAULT_HORIZON);
+    ~HintService();
+
+    HintService(const HintService&) = delete;
+    HintService& operator=(const HintService&) = delete;
+
+    /**
+     * 模型已提交新局面（操作、撤销、重开等）：取消进行中的搜索，缓存未命中时在后台开始新搜索
+     */
+    void onStateChanged(const GameModel* gameModel);
+
+    /**
+     * 当前局面的提示
+     * @return 后台搜索尚未完成时返回 false，完成后会调用提示就绪回调
+     */
+    bool getHint(Hint& outHint) const;
+
+    // 当前局面的提示算好时在主线程回调（命中缓存时立即回调）
+    void setHintReadyCallback(const HintReadyCallback& callback) { _readyCallback = callback; }
+
+    // 换局时清空缓存
+    void clearCache() { _cache.clear(); }
+
+private:
+    struct Request
+    {
+        uint64_t stateKey = 0;
+        GameSnapshot snapshot;
+        std::vector<uint8_t> cardKinds;
+    };
+
+    static uint64_t hashSnapshot(const GameSnapshot& snapshot, const std::vector<uint8_t>& cardKinds);
+    void workerLoop();
+    void deliver(uint64_t stateKey, const Hint& hint);
+
+    MainThreadDispatcher _dispatcher;
+    HintReadyCallback _readyCallback;
+    int _horizon;
+
+    // 主线程独占
+    std::unordered_map<uint64_t, Hint> _cache;
+    uint64_t _currentKey;
+    Request _scratch;                 // 复制局面用的缓冲，交给工作线程时整体交换
+    std::shared_ptr<bool> _aliveToken; // 派发到主线程的回调借此判断本对象是否已销毁
+
+    // 主线程与工作线程共享，由 _mutex 保护
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    Request _pending;
+    bool _hasPending;
+    bool _stopping;
+    std::atomic<bool> _cancel;        // 新局面到来时通知工作线程放弃当前搜索
+
+    std::thread _worker;
+};
+
+#endif // HINT_SERVICE_H
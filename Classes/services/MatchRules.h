@@ -0,0 +1,130 @@
+#pragma once
+#ifndef MATCH_RULES_H
+#define MATCH_RULES_H
+
+#include <cstdint>
+
+/**
+ * 卡牌匹配规则
+ * 每条规则是一个策略类型，提供 constexpr 的 match(face1, suit1, face2, suit2)，
+ * face 取值 0-12（CardFaceType），suit 取值 0-3（CardSuitType）。
+ * MatchTable<Rule> 在编译期把规则展开成 52x52 的位表，另补一行全 0 的无效牌种，
+ * 运行时一次查表即可判定，不含分支，也不打印日志。
+ */
+namespace MatchRules
+{
+    const int FACE_COUNT = 13;
+    const int SUIT_COUNT = 4;
+    const int KIND_COUNT = FACE_COUNT * SUIT_COUNT;
+
+    // 点数或花色无效（含 NONE）的牌统一使用这个牌种下标，对应匹配表中全 0 的一行
+    const int INVALID_KIND = KIND_COUNT;
+
+    constexpr bool isRedSuit(int suit)
+    {
+        return suit == 1 || suit == 2; // DIAMONDS / HEARTS
+    }
+
+    // 点数相差 1（A-2 ... Q-K），不区分花色
+    struct Adjacent
+    {
+        static constexpr bool match(int face1, int /*suit1*/, int face2, int /*suit2*/)
+        {
+            return face1 - face2 == 1 || face2 - face1 == 1;
+        }
+    };
+
+    // 点数相差 1，且 A 与 K 首尾相接
+    struct AdjacentWithWrap
+    {
+        static constexpr bool match(int face1, int suit1, int face2, int suit2)
+        {
+            return Adjacent::match(face1, suit1, face2, suit2)
+                || (face1 == 0 && face2 == 12) || (face1 == 12 && face2 == 0);
+        }
+    };
+
+    // 点数相差 1，且花色颜色相同
+    struct SameColorAdjacent
+    {
+        static constexpr bool match(int face1, int suit1, int face2, int suit2)
+        {
+            return Adjacent::match(face1, suit1, face2, suit2) && isRedSuit(suit1) == isRedSuit(suit2);
+        }
+    };
+
+    namespace detail
+    {
+        struct KindMaskTable
+        {
+            uint64_t masks[KIND_COUNT + 1]; // 末行为 INVALID_KIND
+        };
+
+        template <int... I> struct IndexList {};
+        template <int N, int... I> struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+        template <int... I> struct MakeIndexList<0, I...> { typedef IndexList<I...> type; };
+
+        template <typename Rule>
+        constexpr bool matchKinds(int kind1, int kind2)
+        {
+            return Rule::match(kind1 % FACE_COUNT, kind1 / FACE_COUNT, kind2 % FACE_COUNT, kind2 / FACE_COUNT);
+        }
+
+        template <typename Rule>
+        constexpr uint64_t computeKindMask(int kind, int other)
+        {
+            return kind >= KIND_COUNT || other >= KIND_COUNT ? 0
+                : ((matchKinds<Rule>(kind, other) ? (uint64_t(1) << other) : 0) | computeKindMask<Rule>(kind, other + 1));
+        }
+
+        template <typename Rule, int... I>
+        constexpr KindMaskTable buildKindMaskTable(IndexList<I...>)
+        {
+            return KindMaskTable{ { computeKindMask<Rule>(I, 0)... } };
+        }
+    }
+}
+
+/**
+ * 规则对应的编译期匹配表
+ * 牌种下标 kind = suit * 13 + face（与 CardModel::getKindIndex 一致），
+ * kindMask(kind) 的第 k 位表示能否与牌种 k 匹配。kind 取 [0, 52) 或 INVALID_KIND：
+ * 无效牌种的一行全 0，有效行的第 52 位恒为 0，因此任一方无效时 canMatch 为 false。
+ */
+template <typename Rule>
+class MatchTable
+{
+public:
+    static constexpr int kindOf(int face, int suit) { return suit * MatchRules::FACE_COUNT + face; }
+
+    // 能与牌种 kind 匹配的全部牌种（低 52 位）
+    static uint64_t kindMask(int kind) { return s_table.masks[kind]; }
+
+    static bool canMatch(int kind1, int kind2) { return ((s_table.masks[kind1] >> kind2) & 1u) != 0; }
+
+    // 编译期查询，供 static_assert 等常量表达式使用
+    static constexpr bool canMatchConst(int kind1, int kind2)
+    {
+        return ((MatchRules::detail::computeKindMask<Rule>(kind1, 0) >> kind2) & 1u) != 0;
+    }
+
+private:
+    static constexpr MatchRules::detail::KindMaskTable s_table =
+        MatchRules::detail::buildKindMaskTable<Rule>(MatchRules::detail::MakeIndexList<MatchRules::KIND_COUNT + 1>::type());
+};
+
+template <typename Rule>
+constexpr MatchRules::detail::KindMaskTable MatchTable<Rule>::s_table;
+
+// 当前玩法使用的规则：点数相差 1，A 与 K 不相接
+typedef MatchTable<MatchRules::Adjacent> GameMatchTable;
+
+static_assert(GameMatchTable::canMatchConst(GameMatchTable::kindOf(0, 0), GameMatchTable::kindOf(1, 3)),
+    "A should match 2 regardless of suit");
+static_assert(!GameMatchTable::canMatchConst(GameMatchTable::kindOf(0, 0), GameMatchTable::kindOf(12, 0)),
+    "A and K do not wrap in the current rule");
+static_assert(!GameMatchTable::canMatchConst(GameMatchTable::kindOf(0, 0), MatchRules::INVALID_KIND)
+    && !GameMatchTable::canMatchConst(MatchRules::INVALID_KIND, GameMatchTable::kindOf(1, 0)),
+    "invalid kinds match nothing");
+
+#endif // MATCH_RULES_H
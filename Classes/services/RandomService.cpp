@@ -0,0 +1,42 @@
+#include "RandomService.h"
+#include <chrono>
+#include <random>
+
+namespace {
+    uint64_t splitMix64(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+RandomService::RandomService(uint64_t seed)
+{
+    this->seed(seed);
+}
+
+void RandomService::seed(uint64_t seed)
+{
+    _seed = seed;
+    uint64_t x = seed;
+    for (int i = 0; i < 4; i++) {
+        _state[i] = splitMix64(x);
+    }
+}
+
+uint64_t RandomService::makeEntropySeed()
+{
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    // 部分平台的 random_device 是确定性的，再混入时钟
+    seed ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return seed;
+}
+
+uint64_t RandomService::deriveSeed(uint64_t baseSeed, uint64_t index)
+{
+    uint64_t x = baseSeed ^ (index * 0xD1B54A32D192ED03ULL);
+    return splitMix64(x);
+}
@@ -0,0 +1,99 @@
+#pragma once
+#ifndef RANDOM_SERVICE_H
+#define RANDOM_SERVICE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * 随机数服务
+ * xoshiro256** 生成器，由 64 位种子经 splitmix64 展开初始状态：
+ * 相同种子在任何平台上产生完全相同的序列，任意一局都能凭种子精确复现。
+ * 没有全局状态，每局（每个 GameEngine / 发牌线程）各持一个实例，
+ * 因此不同实例可在多个线程上并行使用；单个实例不做加锁。
+ */
+class RandomService
+{
+public:
+    explicit RandomService(uint64_t seed = 0);
+
+    // 重新播种，序列从头开始
+    void seed(uint64_t seed);
+    uint64_t getSeed() const { return _seed; }
+
+    // 64 位均匀随机数
+    uint64_t next()
+    {
+        const uint64_t result = rotl(_state[1] * 5, 7) * 9;
+        const uint64_t t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = rotl(_state[3], 45);
+        return result;
+    }
+
+    /**
+     * [0, bound) 内的无偏随机整数
+     * Lemire 乘法取高位法，仅在极少数情况下拒绝重采样，不使用取模
+     */
+    uint32_t nextBounded(uint32_t bound)
+    {
+        uint64_t m = static_cast<uint64_t>(static_cast<uint32_t>(next() >> 32)) * bound;
+        uint32_t low = static_cast<uint32_t>(m);
+        if (low < bound) {
+            uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                m = static_cast<uint64_t>(static_cast<uint32_t>(next() >> 32)) * bound;
+                low = static_cast<uint32_t>(m);
+            }
+        }
+        return static_cast<uint32_t>(m >> 32);
+    }
+
+    // [min, max] 闭区间内的无偏随机整数
+    int nextInt(int min, int max)
+    {
+        return min + static_cast<int>(nextBounded(static_cast<uint32_t>(max - min) + 1u));
+    }
+
+    // Fisher-Yates 洗牌
+    template <typename T>
+    void shuffle(T* data, std::size_t count)
+    {
+        for (std::size_t i = count; i > 1; i--) {
+            std::size_t j = nextBounded(static_cast<uint32_t>(i));
+            std::swap(data[i - 1], data[j]);
+        }
+    }
+
+    template <typename T>
+    void shuffle(std::vector<T>& vec)
+    {
+        if (!vec.empty()) shuffle(vec.data(), vec.size());
+    }
+
+    /**
+     * 从系统熵源取一个种子，只用于决定“下一局用哪个种子”，
+     * 发牌本身始终由种子确定
+     */
+    static uint64_t makeEntropySeed();
+
+    /**
+     * 由基础种子与序号派生子种子（splitmix64 混合）
+     * 批量发牌时第 index 局的种子只取决于 (baseSeed, index)，与线程划分无关
+     */
+    static uint64_t deriveSeed(uint64_t baseSeed, uint64_t index);
+
+private:
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    uint64_t _state[4];
+    uint64_t _seed;
+};
+
+#endif // RANDOM_SERVICE_H
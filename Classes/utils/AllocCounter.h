@@ -0,0 +1,33 @@
+#pragma once
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstdint>
+
+/**
+ * 编译期开关 ALLOC_COUNTER_ENABLED（可在编译参数中覆盖）：默认调试构建为 1，发布构建为 0。
+ * 为 1 时本模块替换全局 operator new / delete，每次 new 计数一次（所有线程合计，不含直接 malloc）；
+ * 为 0 时不替换，getAllocationCount 恒为 0。
+ */
+#ifndef ALLOC_COUNTER_ENABLED
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define ALLOC_COUNTER_ENABLED 1
+#else
+#define ALLOC_COUNTER_ENABLED 0
+#endif
+#endif
+
+/**
+ * 堆分配计数
+ * 性能浮层按帧取差值得到每帧分配次数。
+ */
+class AllocCounter
+{
+public:
+    static bool isEnabled() { return ALLOC_COUNTER_ENABLED != 0; }
+
+    // 进程启动以来的 operator new 次数
+    static uint64_t getAllocationCount();
+};
+
+#endif // ALLOC_COUNTER_H
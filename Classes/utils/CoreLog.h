@@ -0,0 +1,18 @@
+#pragma once
+#ifndef CORE_LOG_H
+#define CORE_LOG_H
+
+/**
+ * 核心库日志
+ * 模型、规则等无引擎依赖的代码使用 CORE_LOG 代替 CCLOG：
+ * 在客户端调试构建（COCOS2D_DEBUG > 0）中与 CCLOG 一样输出，其余构建编译为空。
+ * 只用于加载失败等冷路径；逐张牌、逐次操作的热路径日志使用 EVENT_LOG（utils/EventLog.h）。
+ */
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#include <cstdio>
+#define CORE_LOG(format, ...) do { std::fprintf(stderr, format "\n", ##__VA_ARGS__); } while (0)
+#else
+#define CORE_LOG(...) do {} while (0)
+#endif
+
+#endif // CORE_LOG_H
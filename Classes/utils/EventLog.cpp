@@ -0,0 +1,245 @@
+#include "EventLog.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    static_assert((EventLog::CAPACITY & (EventLog::CAPACITY - 1)) == 0, "EventLog::CAPACITY must be a power of two");
+    static_assert(sizeof(EventRecord) == 56, "EventRecord layout is part of the dump format");
+
+    // 槽位的各字段都是原子量（relaxed 读写），读取端与写入端并发时不构成数据竞争
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> sequence;  // 0 表示空或正在写入
+        std::atomic<uint64_t> timestampNs;
+        std::atomic<uint64_t> meta;      // eventId | argCount << 16 | threadIndex << 24
+        std::atomic<uint64_t> args[EventLog::MAX_ARGS];
+    };
+
+    Slot s_slots[EventLog::CAPACITY];
+    std::atomic<uint64_t> s_nextSequence(1);
+    std::atomic<uint32_t> s_threadCount(0);
+    std::atomic<EventLog::EchoOutput> s_echoOutput(nullptr);
+
+    uint8_t currentThreadIndex()
+    {
+        static thread_local uint32_t index = s_threadCount.fetch_add(1, std::memory_order_relaxed);
+        return static_cast<uint8_t>(std::min<uint32_t>(index, 0xFF));
+    }
+
+    uint64_t nowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    uint32_t fnv1a(uint32_t hash, const char* text)
+    {
+        for (; *text; text++) {
+            hash ^= static_cast<uint8_t>(*text);
+            hash *= 16777619u;
+        }
+        return hash ^ 0xFFu; // 字段分隔
+    }
+}
+
+void EventLog::write(LogEventId id, const uint64_t* args, int argCount)
+{
+    const uint64_t sequence = s_nextSequence.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = s_slots[sequence & (CAPACITY - 1)];
+
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestampNs.store(nowNs(), std::memory_order_relaxed);
+    slot.meta.store(static_cast<uint64_t>(id) | (static_cast<uint64_t>(argCount) << 16)
+        | (static_cast<uint64_t>(currentThreadIndex()) << 24), std::memory_order_relaxed);
+    for (int i = 0; i < MAX_ARGS; i++) {
+        slot.args[i].store(i < argCount ? args[i] : 0, std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence, std::memory_order_release);
+
+#if EVENT_LOG_ECHO
+    EventRecord record = {};
+    record.sequence = sequence;
+    record.eventId = static_cast<uint16_t>(id);
+    record.argCount = static_cast<uint8_t>(argCount);
+    for (int i = 0; i < argCount; i++) record.args[i] = args[i];
+    char buffer[256];
+    format(record, buffer, sizeof(buffer));
+    EchoOutput output = s_echoOutput.load(std::memory_order_acquire);
+    if (output) {
+        output(buffer);
+    } else {
+        std::fprintf(stderr, "%s\n", buffer);
+    }
+#endif
+}
+
+void EventLog::setEchoOutput(EchoOutput output)
+{
+    s_echoOutput.store(output, std::memory_order_release);
+}
+
+size_t EventLog::snapshot(std::vector<EventRecord>& outRecords)
+{
+    outRecords.clear();
+    outRecords.reserve(CAPACITY);
+    for (int i = 0; i < CAPACITY; i++) {
+        const Slot& slot = s_slots[i];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == 0) continue;
+
+        EventRecord record = {};
+        record.sequence = sequence;
+        record.timestampNs = slot.timestampNs.load(std::memory_order_relaxed);
+        uint64_t meta = slot.meta.load(std::memory_order_relaxed);
+        for (int a = 0; a < MAX_ARGS; a++) record.args[a] = slot.args[a].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue; // 读取期间被改写
+
+        record.eventId = static_cast<uint16_t>(meta & 0xFFFF);
+        record.argCount = static_cast<uint8_t>((meta >> 16) & 0xFF);
+        record.threadIndex = static_cast<uint8_t>((meta >> 24) & 0xFF);
+        if (record.eventId >= static_cast<uint16_t>(LogEventId::COUNT)) continue;
+        outRecords.push_back(record);
+    }
+    std::sort(outRecords.begin(), outRecords.end(),
+        [](const EventRecord& a, const EventRecord& b) { return a.sequence < b.sequence; });
+    return outRecords.size();
+}
+
+bool EventLog::writeDump(const std::string& path)
+{
+    std::vector<EventRecord> records;
+    snapshot(records);
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+    DumpHeader header = {};
+    header.magic = DUMP_MAGIC;
+    header.version = DUMP_VERSION;
+    header.recordSize = sizeof(EventRecord);
+    header.tableHash = tableHash();
+    header.recordCount = records.size();
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !records.empty()) {
+        ok = std::fwrite(records.data(), sizeof(EventRecord), records.size(), file) == records.size();
+    }
+    return std::fclose(file) == 0 && ok;
+}
+
+bool EventLog::readDump(const std::string& path, DumpHeader& outHeader, std::vector<EventRecord>& outRecords)
+{
+    outRecords.clear();
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+    bool ok = std::fread(&outHeader, sizeof(outHeader), 1, file) == 1
+        && outHeader.magic == DUMP_MAGIC && outHeader.version == DUMP_VERSION
+        && outHeader.recordSize == sizeof(EventRecord);
+    if (ok) {
+        outRecords.resize(static_cast<size_t>(outHeader.recordCount));
+        ok = outRecords.empty()
+            || std::fread(outRecords.data(), sizeof(EventRecord), outRecords.size(), file) == outRecords.size();
+    }
+    std::fclose(file);
+    return ok;
+}
+
+void EventLog::format(const EventRecord& record, char* buffer, size_t bufferSize)
+{
+    if (bufferSize == 0) return;
+    buffer[0] = '\0';
+    if (record.eventId >= static_cast<uint16_t>(LogEventId::COUNT)) {
+        std::snprintf(buffer, bufferSize, "<unknown event %u>", record.eventId);
+        return;
+    }
+
+    // 逐个转换说明取参数：去掉长度修饰后按转换类型以 long long / double 重新交给 snprintf
+    const char* format = LogEvents::formatOf(static_cast<LogEventId>(record.eventId));
+    size_t length = 0;
+    int argIndex = 0;
+    while (*format && length + 1 < bufferSize) {
+        if (*format != '%') {
+            buffer[length++] = *format++;
+            continue;
+        }
+        if (format[1] == '%') {
+            buffer[length++] = '%';
+            format += 2;
+            continue;
+        }
+
+        char spec[32] = "%";
+        size_t specLength = 1;
+        format++;
+        while (*format && std::strchr("-+ #0123456789.", *format) && specLength < 24) spec[specLength++] = *format++;
+        while (*format && std::strchr("hljztL", *format)) format++;
+        char conversion = *format ? *format++ : 'd';
+        uint64_t value = argIndex < record.argCount ? record.args[argIndex] : 0;
+        argIndex++;
+
+        int written;
+        if (std::strchr("fFeEgGaA", conversion)) {
+            spec[specLength++] = conversion;
+            spec[specLength] = '\0';
+            double number;
+            std::memcpy(&number, &value, sizeof(number));
+            written = std::snprintf(buffer + length, bufferSize - length, spec, number);
+        } else if (conversion == 'p') {
+            written = std::snprintf(buffer + length, bufferSize - length, "0x%llx", static_cast<unsigned long long>(value));
+        } else if (std::strchr("uxXo", conversion)) {
+            spec[specLength++] = 'l';
+            spec[specLength++] = 'l';
+            spec[specLength++] = conversion;
+            spec[specLength] = '\0';
+            written = std::snprintf(buffer + length, bufferSize - length, spec, static_cast<unsigned long long>(value));
+        } else {
+            spec[specLength++] = 'l';
+            spec[specLength++] = 'l';
+            spec[specLength++] = 'd';
+            spec[specLength] = '\0';
+            written = std::snprintf(buffer + length, bufferSize - length, spec, static_cast<long long>(value));
+        }
+        if (written < 0) break;
+        length = std::min(length + static_cast<size_t>(written), bufferSize - 1);
+    }
+    buffer[length] = '\0';
+}
+
+const char* EventLog::levelName(LogLevel level)
+{
+    switch (level) {
+    case LogLevel::LEVEL_ERROR: return "ERROR";
+    case LogLevel::LEVEL_WARN: return "WARN";
+    case LogLevel::LEVEL_INFO: return "INFO";
+    case LogLevel::LEVEL_DEBUG: return "DEBUG";
+    case LogLevel::LEVEL_VERBOSE: return "VERBOSE";
+    default: return "OFF";
+    }
+}
+
+const char* EventLog::categoryName(LogCategory category)
+{
+    switch (category) {
+    case LogCategory::MODEL: return "MODEL";
+    case LogCategory::ENGINE: return "ENGINE";
+    case LogCategory::UNDO: return "UNDO";
+    case LogCategory::CONTROLLER: return "CONTROLLER";
+    case LogCategory::VIEW: return "VIEW";
+    case LogCategory::SERVICE: return "SERVICE";
+    default: return "?";
+    }
+}
+
+uint32_t EventLog::tableHash()
+{
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < static_cast<int>(LogEventId::COUNT); i++) {
+        hash = fnv1a(hash, LogEvents::NAMES[i]);
+        hash = fnv1a(hash, categoryName(LogEvents::CATEGORIES[i]));
+        hash = fnv1a(hash, levelName(LogEvents::LEVELS[i]));
+        hash = fnv1a(hash, LogEvents::FORMATS[i]);
+    }
+    return hash;
+}
@@ -0,0 +1,182 @@
+#pragma once
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include "LogEvents.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * 编译期开关（可在编译参数中覆盖）：
+ *   EVENT_LOG_LEVEL       高于此级别的事件编译为空；0 关闭整个设施，EVENT_LOG 展开为空语句。
+ *                         默认调试构建为 DEBUG(4)，发布构建为 INFO(3)
+ *   EVENT_LOG_CATEGORIES  按 LogCategory 位掩码过滤，默认全部
+ *   EVENT_LOG_ECHO        1 时写入的同时格式化输出（setEchoOutput 指定的函数，未指定时为 stderr），默认仅调试构建开启
+ */
+#ifndef EVENT_LOG_LEVEL
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define EVENT_LOG_LEVEL 4
+#else
+#define EVENT_LOG_LEVEL 3
+#endif
+#endif
+
+#ifndef EVENT_LOG_CATEGORIES
+#define EVENT_LOG_CATEGORIES 0xFFFFFFFFu
+#endif
+
+#ifndef EVENT_LOG_ECHO
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define EVENT_LOG_ECHO 1
+#else
+#define EVENT_LOG_ECHO 0
+#endif
+#endif
+
+/**
+ * 一条事件记录（快照与转储文件中的格式）
+ */
+struct EventRecord
+{
+    uint64_t sequence;    // 全局写入序号，从 1 开始
+    uint64_t timestampNs; // steady_clock 纳秒
+    uint16_t eventId;     // LogEventId
+    uint8_t argCount;
+    uint8_t threadIndex;  // 写入线程的序号（按首次写日志的先后分配）
+    uint32_t reserved;
+    uint64_t args[4];     // 整数按 int64 符号扩展，浮点按 double 位模式，指针按地址
+};
+
+/**
+ * 二进制环形事件日志
+ * 热路径只把事件ID与数值参数写入定长 64 字节槽位：一次 fetch_add 取得序号，
+ * 按序号取模定位槽位后写入，不加锁、不分配、不格式化，写满后覆盖最旧的记录。
+ * 读取端（转储）按槽位序号校验（seqlock），跳过正在被改写的槽位。
+ * 格式化由 tools/logdump 离线完成，发布构建也能保留诊断信息而不付出逐条格式化的代价。
+ */
+class EventLog
+{
+public:
+    static const int CAPACITY = 8192; // 槽位数（2 的幂），共 512 KB
+    static const int MAX_ARGS = 4;
+
+    static const uint32_t DUMP_MAGIC = 0x474C5645; // "EVLG"
+    static const uint32_t DUMP_VERSION = 1;
+
+    // 转储文件头，其后紧跟 recordCount 条 EventRecord（小端）
+    struct DumpHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint32_t tableHash;   // 事件表散列，与 logdump 编入的事件表比对
+        uint64_t recordCount;
+    };
+
+    template <typename... Args>
+    static void record(LogEventId id, Args... args)
+    {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "EVENT_LOG supports at most 4 arguments");
+        const uint64_t slots[sizeof...(Args) + 1] = { toSlot(args)..., 0 };
+        write(id, slots, static_cast<int>(sizeof...(Args)));
+    }
+
+    /**
+     * 复制出当前缓冲中的全部有效记录，按序号升序
+     * @return 记录条数
+     */
+    static size_t snapshot(std::vector<EventRecord>& outRecords);
+
+    /**
+     * 即时回显的输出函数，只在 EVENT_LOG_ECHO 为 1 时使用；nullptr 恢复为 stderr
+     * 客户端启动时设为 cocos2d::log，使回显进入 Android logcat 等平台日志
+     */
+    typedef void (*EchoOutput)(const char* line);
+    static void setEchoOutput(EchoOutput output);
+
+    // 写出转储文件（DumpHeader + 记录），可在任意线程调用
+    static bool writeDump(const std::string& path);
+
+    // 读取转储文件；tableHash 不一致时仍读出记录，由调用方决定是否提示
+    static bool readDump(const std::string& path, DumpHeader& outHeader, std::vector<EventRecord>& outRecords);
+
+    // 按事件表格式化一条记录的正文（不含时间与类别）
+    static void format(const EventRecord& record, char* buffer, size_t bufferSize);
+
+    static const char* levelName(LogLevel level);
+    static const char* categoryName(LogCategory category);
+
+    // 事件表（名称、类别、级别、格式串）的散列
+    static uint32_t tableHash();
+
+    // 编译期过滤：级别与类别都启用时为 true
+    static constexpr bool isEnabled(LogEventId id)
+    {
+        return static_cast<int>(LogEvents::levelOf(id)) <= EVENT_LOG_LEVEL
+            && ((EVENT_LOG_CATEGORIES >> static_cast<int>(LogEvents::categoryOf(id))) & 1u) != 0;
+    }
+
+private:
+    static void write(LogEventId id, const uint64_t* args, int argCount);
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value, uint64_t>::type toSlot(T value)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value, uint64_t>::type toSlot(T value)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+
+    static uint64_t toSlot(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static uint64_t toSlot(float value) { return toSlot(static_cast<double>(value)); }
+
+    template <typename T>
+    static uint64_t toSlot(T* pointer) { return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)); }
+
+    // 字符串的内容不会被保存，只能用 CORE_LOG/CCLOG 输出
+    static uint64_t toSlot(const char*) = delete;
+    static uint64_t toSlot(char*) = delete;
+};
+
+/**
+ * EVENT_LOG(事件名, 参数...)
+ * 事件名为 LogEvents.h 中登记的名称；参数个数在编译期与格式串核对。
+ * 级别或类别未启用时条件为编译期常量 false，参数不会被求值；EVENT_LOG_LEVEL 为 0 时整个宏为空。
+ */
+#if EVENT_LOG_LEVEL > 0
+#define EVENT_LOG(event, ...) \
+    do { \
+        static_assert(LogEvents::countConversions(LogEvents::formatOf(LogEventId::event)) \
+            == EventLogDetail::ArgCount<decltype(EventLogDetail::argTypes(__VA_ARGS__))>::value, \
+            "EVENT_LOG argument count does not match the format of " #event); \
+        if (EventLog::isEnabled(LogEventId::event)) EventLog::record(LogEventId::event, ##__VA_ARGS__); \
+    } while (0)
+#else
+#define EVENT_LOG(event, ...) do {} while (0)
+#endif
+
+namespace EventLogDetail
+{
+    template <typename... Args> struct TypeList {};
+    template <typename List> struct ArgCount;
+    template <typename... Args> struct ArgCount<TypeList<Args...>> { static const int value = sizeof...(Args); };
+
+    // 只用于 decltype 取参数个数，不会被调用
+    template <typename... Args> TypeList<Args...> argTypes(const Args&...);
+}
+
+#endif // EVENT_LOG_H
@@ -0,0 +1,68 @@
+#include "FrameStats.h"
+#include <algorithm>
+
+namespace {
+    // values 会被重排；fraction 取 [0, 1]
+    float percentile(std::vector<float>& values, float fraction)
+    {
+        if (values.empty()) return 0.0f;
+        size_t index = static_cast<size_t>(fraction * (values.size() - 1) + 0.5f);
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+}
+
+FrameStats::FrameStats()
+    : _samples(WINDOW)
+    , _modelUpdatePending(false)
+{
+    _scratch.reserve(WINDOW);
+}
+
+void FrameStats::addFrame(float frameMs, float workMs, int allocations)
+{
+    FrameSample sample;
+    sample.frameMs = frameMs;
+    sample.workMs = workMs;
+    sample.allocations = allocations;
+    sample.afterModelUpdate = _modelUpdatePending;
+    _modelUpdatePending = false;
+    _samples.pushBack(sample);
+}
+
+FrameStats::Summary FrameStats::summarize() const
+{
+    Summary summary = {};
+    summary.frameCount = _samples.size();
+    if (summary.frameCount == 0) return summary;
+
+    long long totalAllocations = 0;
+    _scratch.clear();
+    for (int i = 0; i < _samples.size(); i++) {
+        const FrameSample& sample = _samples[i];
+        summary.maxMs = std::max(summary.maxMs, sample.frameMs);
+        summary.maxWorkMs = std::max(summary.maxWorkMs, sample.workMs);
+        summary.maxAllocations = std::max(summary.maxAllocations, sample.allocations);
+        totalAllocations += sample.allocations;
+        if (sample.afterModelUpdate) {
+            _scratch.push_back(sample.frameMs);
+            summary.modelMaxMs = std::max(summary.modelMaxMs, sample.frameMs);
+        }
+    }
+    summary.averageAllocations = static_cast<float>(totalAllocations) / summary.frameCount;
+    summary.modelFrameCount = static_cast<int>(_scratch.size());
+    summary.modelP95 = percentile(_scratch, 0.95f);
+
+    _scratch.clear();
+    for (int i = 0; i < _samples.size(); i++) _scratch.push_back(_samples[i].frameMs);
+    summary.p50 = percentile(_scratch, 0.50f);
+    summary.p95 = percentile(_scratch, 0.95f);
+    summary.p99 = percentile(_scratch, 0.99f);
+    return summary;
+}
+
+void FrameStats::reset()
+{
+    _samples.clear();
+    _modelUpdatePending = false;
+}
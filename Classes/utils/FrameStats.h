@@ -0,0 +1,67 @@
+#pragma once
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include "RingBuffer.h"
+#include <vector>
+
+/**
+ * 一帧的采样
+ */
+struct FrameSample
+{
+    float frameMs;          // 与上一帧结束的间隔（含等待垂直同步），卡顿体现在这里
+    float workMs;           // 本帧更新 + 遍历 + 渲染的 CPU 耗时
+    int allocations;        // 本帧的堆分配次数
+    bool afterModelUpdate;  // 本帧之前控制器提交过模型（点击、抽牌、撤销等）
+};
+
+/**
+ * 滚动帧耗时统计
+ * 保留最近 WINDOW 帧，按需计算分位数；模型提交后的帧单独统计，便于对比点击帧与普通帧。
+ * 不依赖 cocos2d-x。
+ */
+class FrameStats
+{
+public:
+    static const int WINDOW = 600; // 60fps 下约 10 秒
+
+    struct Summary
+    {
+        int frameCount;
+        float p50;
+        float p95;
+        float p99;
+        float maxMs;
+        float maxWorkMs;
+        float averageAllocations;
+        int maxAllocations;
+
+        int modelFrameCount;    // 窗口内模型提交后的帧数
+        float modelP95;
+        float modelMaxMs;
+    };
+
+    FrameStats();
+
+    // 下一帧记录为模型提交后的帧
+    void markModelUpdate() { _modelUpdatePending = true; }
+
+    void addFrame(float frameMs, float workMs, int allocations);
+
+    // 汇总窗口内的帧；复制到内部暂存数组后用 nth_element 取分位数
+    Summary summarize() const;
+
+    int getFrameCount() const { return _samples.size(); }
+    // 第 i 帧，0 为最旧
+    const FrameSample& getFrame(int i) const { return _samples[i]; }
+
+    void reset();
+
+private:
+    RingBuffer<FrameSample> _samples;
+    bool _modelUpdatePending;
+    mutable std::vector<float> _scratch;
+};
+
+#endif // FRAME_STATS_H
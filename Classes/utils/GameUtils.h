@@ -1,30 +0,0 @@
-#pragma once
-#ifndef GAME_UTILS_H
-#define GAME_UTILS_H
-
-#include "cocos2d.h"
-
-/**
- * Ϸ
- * ṩͨõĹߺ
- */
-class GameUtils
-{
-public:
-    /**
-     * ΨһĿID
-     */
-    static int generateCardId();
-
-    /**
-     * ſǷƥ䣨1
-     */
-    static bool isCardsMatch(int cardValue1, int cardValue2);
-
-    /**
-     * ȡ
-     */
-    static int getRandomInt(int min, int max);
-};
-
-#endif // GAME_UTILS_H
\ No newline at end of file
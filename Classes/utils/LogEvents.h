@@ -0,0 +1,94 @@
+#pragma once
+#ifndef LOG_EVENTS_H
+#define LOG_EVENTS_H
+
+#include <cstdint>
+
+/**
+ * 事件日志的级别、类别与事件表
+ * 每个事件在此登记一次：名称、类别、级别与格式串。调用处只写入事件ID与整数/浮点参数，
+ * 格式化推迟到 logdump 工具（或调试构建的即时回显）中进行，因此格式串只支持数值转换，不支持 %s。
+ * 新事件一律追加到所属类别的末尾附近即可；事件ID随表顺序变化，转储文件带表散列，
+ * 与工具的事件表不一致时工具会给出提示。
+ */
+/**
+ * 日志级别，带 LEVEL_ 前缀：ERROR、DEBUG 在 Windows 与 Xcode 调试构建中是预定义宏
+ */
+enum class LogLevel : uint8_t
+{
+    LEVEL_OFF = 0,
+    LEVEL_ERROR = 1,
+    LEVEL_WARN = 2,
+    LEVEL_INFO = 3,
+    LEVEL_DEBUG = 4,
+    LEVEL_VERBOSE = 5
+};
+
+enum class LogCategory : uint8_t
+{
+    MODEL = 0,      // GameModel 的牌面变化
+    ENGINE = 1,     // GameEngine 的操作与计分
+    UNDO = 2,       // 撤销记录
+    CONTROLLER = 3, // GameController 的流程
+    VIEW = 4,       // 视图与输入
+    SERVICE = 5,    // 发牌等服务
+    COUNT = 6
+};
+
+// X(名称, 类别, 级别, 格式串)
+#define LOG_EVENT_LIST(X) \
+    X(MODEL_STACK_EMPTY,        MODEL,      LEVEL_WARN,    "GameModel: Stack is empty, cannot draw") \
+    X(MODEL_DRAW_FROM_STACK,    MODEL,      LEVEL_DEBUG,   "GameModel: Drew card %d from stack, remaining stack size: %d") \
+    X(MODEL_ADD_TO_BOTTOM,      MODEL,      LEVEL_DEBUG,   "GameModel: Adding card %d to bottom, current bottom card: %d") \
+    X(MODEL_DRAW_TO_PLAY_FIELD, MODEL,      LEVEL_DEBUG,   "GameModel: Drew card %d from stack to play field at (%.1f, %.1f), stack remaining: %d") \
+    X(MODEL_ADD_TO_PLAY_FIELD,  MODEL,      LEVEL_DEBUG,   "GameModel: Added card %d to play field") \
+    X(ENGINE_MATCH,             ENGINE,     LEVEL_INFO,    "GameEngine: Combo x%d! Score +%d, total: %d") \
+    X(ENGINE_DRAW_PENALTY,      ENGINE,     LEVEL_INFO,    "GameEngine: DRAW penalty %d, total: %d") \
+    X(UNDO_DEPTH_SET,           UNDO,       LEVEL_INFO,    "UndoManager: Undo depth set to %d") \
+    X(UNDO_CLEARED,             UNDO,       LEVEL_DEBUG,   "UndoManager: Cleared all undo records") \
+    X(UNDO_PUSH,                UNDO,       LEVEL_VERBOSE, "UndoManager: Pushed operation %d card %d, %d records") \
+    X(UNDO_POP,                 UNDO,       LEVEL_VERBOSE, "UndoManager: Popped operation %d card %d, %d records") \
+    X(CONTROLLER_DEAL,          CONTROLLER, LEVEL_INFO,    "GameController: Dealt game with seed %llu") \
+    X(CONTROLLER_RESTART,       CONTROLLER, LEVEL_INFO,    "GameController: Game restarted with seed %llu") \
+    X(VIEW_DRAW_AREA_CLICKED,   VIEW,       LEVEL_DEBUG,   "GameView: DRAW area clicked") \
+    X(VIEW_FRAME_INTERVAL,      VIEW,       LEVEL_DEBUG,   "FrameRateManager: Frame interval %.1f ms, idle %d") \
+    X(VIEW_BOOT_INTERACTIVE,    VIEW,       LEVEL_INFO,    "BootScene: Time to interactive %.1f ms (textures %.1f ms, deal %.1f ms, faces %.1f ms)")
+
+enum class LogEventId : uint16_t
+{
+#define LOG_EVENT_ENUM(name, category, level, format) name,
+    LOG_EVENT_LIST(LOG_EVENT_ENUM)
+#undef LOG_EVENT_ENUM
+    COUNT
+};
+
+namespace LogEvents
+{
+#define LOG_EVENT_CATEGORY(name, category, level, format) LogCategory::category,
+#define LOG_EVENT_LEVEL(name, category, level, format) LogLevel::level,
+#define LOG_EVENT_FORMAT(name, category, level, format) format,
+#define LOG_EVENT_NAME(name, category, level, format) #name,
+    constexpr LogCategory CATEGORIES[] = { LOG_EVENT_LIST(LOG_EVENT_CATEGORY) };
+    constexpr LogLevel LEVELS[] = { LOG_EVENT_LIST(LOG_EVENT_LEVEL) };
+    constexpr const char* FORMATS[] = { LOG_EVENT_LIST(LOG_EVENT_FORMAT) };
+    constexpr const char* NAMES[] = { LOG_EVENT_LIST(LOG_EVENT_NAME) };
+#undef LOG_EVENT_CATEGORY
+#undef LOG_EVENT_LEVEL
+#undef LOG_EVENT_FORMAT
+#undef LOG_EVENT_NAME
+
+    constexpr LogCategory categoryOf(LogEventId id) { return CATEGORIES[static_cast<int>(id)]; }
+    constexpr LogLevel levelOf(LogEventId id) { return LEVELS[static_cast<int>(id)]; }
+    constexpr const char* formatOf(LogEventId id) { return FORMATS[static_cast<int>(id)]; }
+
+    // 格式串中的转换个数（%% 不计），编译期与调用处的参数个数核对
+    constexpr int countConversions(const char* format)
+    {
+        return *format == '\0' ? 0
+            : *format != '%' ? countConversions(format + 1)
+            : format[1] == '%' ? countConversions(format + 2)
+            : 1 + countConversions(format + 1);
+    }
+}
+
+#endif // LOG_EVENTS_H
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * 只读内存映射文件
+ * 整个文件映射进地址空间，由操作系统按页调入，打开大文件不产生整体读取与拷贝。
+ * 只接受文件系统上的真实路径（Android 上需先从 APK 解出到可写目录）。
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * 映射文件，已打开时先关闭
+     * @return 文件不存在、为空或映射失败时返回 false
+     */
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return _data != nullptr; }
+    const uint8_t* data() const { return _data; }
+    size_t size() const { return _size; }
+
+private:
+    const uint8_t* _data;
+    size_t _size;
+#ifdef _WIN32
+    void* _fileHandle;
+    void* _mappingHandle;
+#endif
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,97 @@
+#pragma once
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <vector>
+
+/**
+ * 定容环形缓冲
+ * 容量在 setCapacity 时一次性分配，之后入队出队不再分配内存；
+ * 写满后 pushBack 覆盖最旧的元素。元素类型需可默认构造与赋值（通常为 POD）。
+ * 不依赖 cocos2d-x。
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+    explicit RingBuffer(int capacity = 0)
+        : _head(0)
+        , _count(0)
+    {
+        setCapacity(capacity);
+    }
+
+    // 重新设定容量并清空
+    void setCapacity(int capacity)
+    {
+        _slots.assign(capacity > 0 ? capacity : 0, T());
+        _head = 0;
+        _count = 0;
+    }
+
+    int capacity() const { return static_cast<int>(_slots.size()); }
+    int size() const { return _count; }
+    bool empty() const { return _count == 0; }
+    bool full() const { return _count == capacity(); }
+
+    void clear()
+    {
+        _head = 0;
+        _count = 0;
+    }
+
+    /**
+     * 追加到队尾
+     * @return 缓冲已满、覆盖了最旧元素时返回 true；容量为 0 时丢弃并返回 true
+     */
+    bool pushBack(const T& value)
+    {
+        if (_slots.empty()) return true;
+        if (full()) {
+            _slots[_head] = value;
+            _head = next(_head);
+            return true;
+        }
+        _slots[index(_count)] = value;
+        _count++;
+        return false;
+    }
+
+    void popFront()
+    {
+        if (_count == 0) return;
+        _head = next(_head);
+        _count--;
+    }
+
+    void popBack()
+    {
+        if (_count == 0) return;
+        _count--;
+    }
+
+    // 调用方保证非空
+    T& front() { return _slots[_head]; }
+    const T& front() const { return _slots[_head]; }
+    T& back() { return _slots[index(_count - 1)]; }
+    const T& back() const { return _slots[index(_count - 1)]; }
+
+    // 第 i 个元素，0 为最旧
+    T& operator[](int i) { return _slots[index(i)]; }
+    const T& operator[](int i) const { return _slots[index(i)]; }
+
+private:
+    int index(int offset) const
+    {
+        int i = _head + offset;
+        return i >= capacity() ? i - capacity() : i;
+    }
+
+    int next(int i) const { return i + 1 == capacity() ? 0 : i + 1; }
+
+    std::vector<T> _slots;
+    int _head;
+    int _count;
+};
+
+#endif // RING_BUFFER_H
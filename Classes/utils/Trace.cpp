@@ -0,0 +1,199 @@
+#include "Trace.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+namespace {
+    const uint64_t INSTANT_DURATION = UINT64_MAX;
+
+    // 记录的各字段为原子量（relaxed），导出线程与写入线程并发时不构成数据竞争
+    struct TraceEvent
+    {
+        std::atomic<const char*> name;
+        std::atomic<uint64_t> startNs;
+        std::atomic<uint64_t> durationNs; // INSTANT_DURATION 表示瞬时事件
+        std::atomic<int64_t> value;
+    };
+
+    struct ThreadBuffer
+    {
+        TraceEvent events[Trace::EVENTS_PER_THREAD];
+        std::atomic<uint64_t> count;      // 已写入的总条数，只由所属线程递增
+        std::atomic<uint64_t> clearedAt;  // clear 时的 count，导出只取其后的记录
+        std::atomic<const char*> threadName;
+        std::atomic<bool> active;         // 所属线程是否存活，退出后缓冲可被新线程复用
+    };
+
+    // 线程退出时把缓冲标记为空闲；缓冲本身不释放，已记录的事件在复用前仍可导出
+    struct ThreadSlot
+    {
+        ThreadBuffer* buffer = nullptr;
+        bool registered = false;
+
+        ~ThreadSlot()
+        {
+            if (buffer) buffer->active.store(false, std::memory_order_release);
+        }
+    };
+
+    std::mutex s_registryMutex;
+    ThreadBuffer* s_buffers[Trace::MAX_THREADS] = {};
+    std::atomic<int> s_bufferCount(0);
+    std::atomic<bool> s_enabled(true);
+    const uint64_t s_originNs = Trace::nowNs();
+
+    // 复用已退出线程的缓冲：丢弃其旧记录，避免导出时挂到新线程名下
+    ThreadBuffer* recycleBuffer(int bufferCount)
+    {
+        for (int i = 0; i < bufferCount; i++) {
+            ThreadBuffer* buffer = s_buffers[i];
+            if (buffer->active.load(std::memory_order_acquire)) continue;
+            buffer->active.store(true, std::memory_order_relaxed);
+            buffer->threadName.store(nullptr, std::memory_order_relaxed);
+            buffer->clearedAt.store(buffer->count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return buffer;
+        }
+        return nullptr;
+    }
+
+    // 线程首次记录时登记缓冲；缓冲随进程存活，线程退出后仍可导出，
+    // 登记满 MAX_THREADS 个之后新线程复用已退出线程的缓冲
+    ThreadBuffer* currentBuffer()
+    {
+        static thread_local ThreadSlot slot;
+        if (slot.registered) return slot.buffer;
+
+        slot.registered = true;
+        std::lock_guard<std::mutex> lock(s_registryMutex);
+        int index = s_bufferCount.load(std::memory_order_relaxed);
+        if (index >= Trace::MAX_THREADS) {
+            slot.buffer = recycleBuffer(index);
+            return slot.buffer;
+        }
+        ThreadBuffer* buffer = new ThreadBuffer();
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->clearedAt.store(0, std::memory_order_relaxed);
+        buffer->threadName.store(nullptr, std::memory_order_relaxed);
+        buffer->active.store(true, std::memory_order_relaxed);
+        s_buffers[index] = buffer;
+        s_bufferCount.store(index + 1, std::memory_order_release);
+        slot.buffer = buffer;
+        return buffer;
+    }
+
+    void append(const char* name, uint64_t startNs, uint64_t durationNs, int64_t value)
+    {
+        ThreadBuffer* buffer = currentBuffer();
+        if (!buffer) return;
+        uint64_t index = buffer->count.load(std::memory_order_relaxed);
+        TraceEvent& event = buffer->events[index % Trace::EVENTS_PER_THREAD];
+        // 先于改写槽位：导出线程读到新字段时必然也读到不小于 index 的 count
+        std::atomic_thread_fence(std::memory_order_release);
+        event.name.store(name, std::memory_order_relaxed);
+        event.startNs.store(startNs, std::memory_order_relaxed);
+        event.durationNs.store(durationNs, std::memory_order_relaxed);
+        event.value.store(value, std::memory_order_relaxed);
+        buffer->count.store(index + 1, std::memory_order_release);
+    }
+
+    void writeEscaped(FILE* file, const char* text)
+    {
+        for (; *text; text++) {
+            if (*text == '"' || *text == '\\') std::fputc('\\', file);
+            if (static_cast<unsigned char>(*text) >= 0x20) std::fputc(*text, file);
+        }
+    }
+}
+
+uint64_t Trace::nowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Trace::setEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Trace::isEnabled()
+{
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+void Trace::setThreadName(const char* name)
+{
+    ThreadBuffer* buffer = currentBuffer();
+    if (buffer) buffer->threadName.store(name, std::memory_order_relaxed);
+}
+
+void Trace::recordComplete(const char* name, uint64_t startNs, uint64_t endNs, int64_t value)
+{
+    if (!isEnabled()) return;
+    append(name, startNs, endNs > startNs ? endNs - startNs : 0, value);
+}
+
+void Trace::recordInstant(const char* name, int64_t value)
+{
+    if (!isEnabled()) return;
+    append(name, nowNs(), INSTANT_DURATION, value);
+}
+
+int Trace::writeChromeTrace(const std::string& path)
+{
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return -1;
+
+    std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    int written = 0;
+    int bufferCount = s_bufferCount.load(std::memory_order_acquire);
+    for (int tid = 0; tid < bufferCount; tid++) {
+        ThreadBuffer* buffer = s_buffers[tid];
+        const char* threadName = buffer->threadName.load(std::memory_order_relaxed);
+        std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"",
+            written > 0 || tid > 0 ? ",\n" : "", tid);
+        if (threadName) writeEscaped(file, threadName);
+        else std::fprintf(file, "thread %d", tid);
+        std::fprintf(file, "\"}}");
+
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        uint64_t first = count > static_cast<uint64_t>(EVENTS_PER_THREAD) ? count - EVENTS_PER_THREAD : 0;
+        uint64_t clearedAt = buffer->clearedAt.load(std::memory_order_relaxed);
+        if (first < clearedAt) first = clearedAt;
+        for (uint64_t i = first; i < count; i++) {
+            const TraceEvent& event = buffer->events[i % EVENTS_PER_THREAD];
+            const char* name = event.name.load(std::memory_order_relaxed);
+            uint64_t startNs = event.startNs.load(std::memory_order_relaxed);
+            uint64_t durationNs = event.durationNs.load(std::memory_order_relaxed);
+            int64_t value = event.value.load(std::memory_order_relaxed);
+            // 导出期间所属线程继续写入：已被覆盖或正在改写（count 已到 i + EVENTS_PER_THREAD）的槽位丢弃
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t latest = buffer->count.load(std::memory_order_relaxed);
+            if (latest >= i + EVENTS_PER_THREAD || !name) continue;
+
+            std::fprintf(file, ",\n{\"name\":\"");
+            writeEscaped(file, name);
+            double ts = (static_cast<int64_t>(startNs - s_originNs)) / 1000.0;
+            if (durationNs == INSTANT_DURATION) {
+                std::fprintf(file, "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f", tid, ts);
+            } else {
+                std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f", tid, ts, durationNs / 1000.0);
+            }
+            if (value != NO_VALUE) std::fprintf(file, ",\"args\":{\"value\":%lld}", static_cast<long long>(value));
+            std::fprintf(file, "}");
+            written++;
+        }
+    }
+    std::fprintf(file, "\n]}\n");
+    bool ok = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && ok ? written : -1;
+}
+
+void Trace::clear()
+{
+    int bufferCount = s_bufferCount.load(std::memory_order_acquire);
+    for (int i = 0; i < bufferCount; i++) {
+        s_buffers[i]->clearedAt.store(s_buffers[i]->count.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * 编译期开关 TRACE_ENABLED（可在编译参数中覆盖）：默认调试构建为 1，发布构建为 0。
+ * 为 0 时 TRACE_* 宏全部展开为空语句。
+ */
+#ifndef TRACE_ENABLED
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define TRACE_ENABLED 1
+#else
+#define TRACE_ENABLED 0
+#endif
+#endif
+
+/**
+ * 区间追踪
+ * 每个线程各有一个定长环形缓冲（首次记录时创建，线程退出后留给新线程复用），记录“名称 + 开始时间 + 时长 + 可选数值”，
+ * 写入不加锁、不分配；满后覆盖最旧的记录。writeChromeTrace 把所有线程的缓冲导出为
+ * Chrome / Perfetto 可直接打开的 JSON（chrome://tracing 或 ui.perfetto.dev）。
+ * 名称必须是字符串字面量等静态存储的字符串，缓冲中只保存指针。
+ */
+class Trace
+{
+public:
+    static const int EVENTS_PER_THREAD = 16384; // 每线程 512 KB
+    static const int MAX_THREADS = 16;          // 缓冲上限；登记满后复用已退出线程的缓冲，同时存活超过此数的线程不记录
+    static const int64_t NO_VALUE = INT64_MIN;
+
+    static uint64_t nowNs();
+
+    // 运行期开关，默认开启；关闭后每个追踪点只剩一次原子读
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    // 当前线程在导出文件中显示的名称（静态字符串）
+    static void setThreadName(const char* name);
+
+    // 记录一个已结束的区间；value 为 NO_VALUE 时不带参数
+    static void recordComplete(const char* name, uint64_t startNs, uint64_t endNs, int64_t value = NO_VALUE);
+
+    // 记录一个瞬时事件
+    static void recordInstant(const char* name, int64_t value = NO_VALUE);
+
+    /**
+     * 导出所有线程缓冲中的记录为 Chrome trace JSON，可在任意线程调用
+     * @return 写出的事件数，失败返回 -1
+     */
+    static int writeChromeTrace(const std::string& path);
+
+    // 丢弃已记录的全部事件
+    static void clear();
+};
+
+/**
+ * 作用域计时：构造时取开始时间，析构时记录区间
+ */
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name, int64_t value = Trace::NO_VALUE)
+        : _name(name)
+        , _value(value)
+        , _startNs(Trace::isEnabled() ? Trace::nowNs() : 0)
+    {
+    }
+
+    ~TraceScope()
+    {
+        if (_startNs != 0) Trace::recordComplete(_name, _startNs, Trace::nowNs(), _value);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* _name;
+    int64_t _value;
+    uint64_t _startNs;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#if TRACE_ENABLED
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
+#define TRACE_SCOPE_VALUE(name, value) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name, static_cast<int64_t>(value))
+#define TRACE_INSTANT(name) Trace::recordInstant(name)
+#define TRACE_THREAD_NAME(name) Trace::setThreadName(name)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#define TRACE_SCOPE_VALUE(name, value) do {} while (0)
+#define TRACE_INSTANT(name) do {} while (0)
+#define TRACE_THREAD_NAME(name) do {} while (0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,315 @@
+#include "CardFaceCache.h"
+
+USING_NS_CC;
+
+namespace {
+    const char* const CARD_BACKGROUND_FILE = "res/card_general.png";
+    const float FALLBACK_CARD_WIDTH = 100.0f;
+    const float FALLBACK_CARD_HEIGHT = 150.0f;
+
+    CardFaceCache* s_instance = nullptr;
+    bool s_atlasLoaded = false;
+
+    const char* faceName(int faceValue)
+    {
+        static const char* const names[] = { "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K" };
+        return (faceValue >= 1 && faceValue <= 13) ? names[faceValue - 1] : "";
+    }
+
+    bool isRedSuit(CardSuitType suit)
+    {
+        return suit == CardSuitType::HEARTS || suit == CardSuitType::DIAMONDS;
+    }
+
+    std::string numberFile(bool big, bool red, int faceValue)
+    {
+        return std::string("res/number/") + (big ? "big_" : "small_") + (red ? "red_" : "black_") + faceName(faceValue) + ".png";
+    }
+
+    const char* suitFile(CardSuitType suit)
+    {
+        switch (suit) {
+        case CardSuitType::CLUBS:    return "res/suits/club.png";
+        case CardSuitType::DIAMONDS: return "res/suits/diamond.png";
+        case CardSuitType::HEARTS:   return "res/suits/heart.png";
+        case CardSuitType::SPADES:   return "res/suits/spade.png";
+        default: return nullptr;
+        }
+    }
+
+    // 合成用的素材精灵：图集帧优先，其次单独文件
+    Sprite* createImageSprite(const std::string& filename)
+    {
+        if (s_atlasLoaded) {
+            SpriteFrame* frame = SpriteFrameCache::getInstance()->getSpriteFrameByName(filename);
+            if (frame) return Sprite::createWithSpriteFrame(frame);
+        }
+        return Sprite::create(filename);
+    }
+
+    DrawNode* createFallbackBackground(const Color4F& fill)
+    {
+        auto drawNode = DrawNode::create();
+        Vec2 rectangle[4];
+        rectangle[0] = Vec2(0, 0);
+        rectangle[1] = Vec2(FALLBACK_CARD_WIDTH, 0);
+        rectangle[2] = Vec2(FALLBACK_CARD_WIDTH, FALLBACK_CARD_HEIGHT);
+        rectangle[3] = Vec2(0, FALLBACK_CARD_HEIGHT);
+        drawNode->drawPolygon(rectangle, 4, fill, 1, Color4F(0, 0, 0, 1));
+        return drawNode;
+    }
+
+    // 卡牌底图，左下角为原点
+    Node* createBackground(const Color4F& fallbackFill)
+    {
+        Sprite* background = createImageSprite(CARD_BACKGROUND_FILE);
+        if (background) {
+            background->setAnchorPoint(Vec2::ZERO);
+            return background;
+        }
+        return createFallbackBackground(fallbackFill);
+    }
+}
+
+const char* const CardFaceCache::ATLAS_PLIST = "res/cards.plist";
+const char* const CardFaceCache::ATLAS_TEXTURE = "res/cards.png";
+
+CardFaceCache* CardFaceCache::getInstance()
+{
+    if (!s_instance) s_instance = new CardFaceCache();
+    return s_instance;
+}
+
+void CardFaceCache::destroyInstance()
+{
+    delete s_instance;
+    s_instance = nullptr;
+}
+
+bool CardFaceCache::preloadAtlas()
+{
+    if (!s_atlasLoaded && FileUtils::getInstance()->isFileExist(ATLAS_PLIST)) {
+        SpriteFrameCache::getInstance()->addSpriteFramesWithFile(ATLAS_PLIST);
+        s_atlasLoaded = SpriteFrameCache::getInstance()->getSpriteFrameByName(CARD_BACKGROUND_FILE) != nullptr;
+    }
+    if (!s_atlasLoaded) {
+        CCLOG("CardFaceCache: card atlas %s not available, falling back to separate textures", ATLAS_PLIST);
+    }
+    return s_atlasLoaded;
+}
+
+void CardFaceCache::preloadTexturesAsync(const std::function<void(bool)>& callback)
+{
+    TextureCache* textureCache = Director::getInstance()->getTextureCache();
+    FileUtils* fileUtils = FileUtils::getInstance();
+    if (!s_atlasLoaded && fileUtils->isFileExist(ATLAS_PLIST) && fileUtils->isFileExist(ATLAS_TEXTURE)) {
+        textureCache->addImageAsync(ATLAS_TEXTURE, [callback](Texture2D* texture) {
+            if (texture) {
+                SpriteFrameCache::getInstance()->addSpriteFramesWithFile(ATLAS_PLIST, texture);
+                s_atlasLoaded = SpriteFrameCache::getInstance()->getSpriteFrameByName(CARD_BACKGROUND_FILE) != nullptr;
+            }
+            if (!s_atlasLoaded) {
+                CCLOG("CardFaceCache: card atlas %s not available, falling back to separate textures", ATLAS_PLIST);
+            }
+            if (callback) callback(s_atlasLoaded);
+        });
+        return;
+    }
+    if (s_atlasLoaded) {
+        if (callback) callback(true);
+        return;
+    }
+
+    // 没有图集：后台载入合成要用到的全部素材文件，缺失的文件跳过（合成时以纯色与文字替代）
+    std::vector<std::string> candidates;
+    candidates.push_back(CARD_BACKGROUND_FILE);
+    for (int faceValue = 1; faceValue <= 13; faceValue++) {
+        for (int variant = 0; variant < 4; variant++) {
+            candidates.push_back(numberFile(variant < 2, variant % 2 == 1, faceValue));
+        }
+    }
+    for (int suit = 0; suit < 4; suit++) {
+        const char* filename = suitFile(static_cast<CardSuitType>(suit));
+        if (filename) candidates.push_back(filename);
+    }
+    std::vector<std::string> files;
+    for (const std::string& file : candidates) {
+        if (fileUtils->isFileExist(file)) files.push_back(file);
+    }
+    if (files.empty()) {
+        if (callback) callback(false);
+        return;
+    }
+    auto pending = std::make_shared<int>(static_cast<int>(files.size()));
+    for (const std::string& file : files) {
+        textureCache->addImageAsync(file, [callback, pending](Texture2D*) {
+            if (--*pending == 0 && callback) callback(false);
+        });
+    }
+}
+
+CardFaceCache::CardFaceCache()
+    : _renderTexture(nullptr)
+    , _rendererRecreatedListener(nullptr)
+{
+    for (int i = 0; i < SLOT_COUNT; i++) _frames[i] = nullptr;
+
+#if CC_ENABLE_CACHE_TEXTURE_DATA
+    // Android 上 GL 上下文重建后渲染纹理内容丢失，全部牌面下次取用时重新合成
+    _rendererRecreatedListener = Director::getInstance()->getEventDispatcher()->addCustomEventListener(
+        EVENT_RENDERER_RECREATED, [this](EventCustom*) { _composed.reset(); });
+#endif
+}
+
+CardFaceCache::~CardFaceCache()
+{
+    if (_rendererRecreatedListener) {
+        Director::getInstance()->getEventDispatcher()->removeEventListener(_rendererRecreatedListener);
+    }
+    for (int i = 0; i < SLOT_COUNT; i++) CC_SAFE_RELEASE(_frames[i]);
+    CC_SAFE_RELEASE(_renderTexture);
+}
+
+bool CardFaceCache::ensureTexture()
+{
+    if (_renderTexture) return true;
+
+    Node* probe = createBackground(Color4F::WHITE);
+    _cardSize = probe->getContentSize();
+    if (_cardSize.width <= 0 || _cardSize.height <= 0) {
+        _cardSize = Size(FALLBACK_CARD_WIDTH, FALLBACK_CARD_HEIGHT);
+    }
+
+    const int rows = (SLOT_COUNT + SLOT_COLUMNS - 1) / SLOT_COLUMNS;
+    int width = static_cast<int>(SLOT_COLUMNS * (_cardSize.width + SLOT_PADDING * 2));
+    int height = static_cast<int>(rows * (_cardSize.height + SLOT_PADDING * 2));
+    _renderTexture = RenderTexture::create(width, height, Texture2D::PixelFormat::RGBA8888);
+    if (!_renderTexture) {
+        CCLOG("CardFaceCache: failed to create %dx%d render texture", width, height);
+        return false;
+    }
+    _renderTexture->retain();
+    _renderTexture->getSprite()->getTexture()->setAntiAliasTexParameters();
+
+    _renderTexture->beginWithClear(0, 0, 0, 0);
+    _renderTexture->end();
+    Director::getInstance()->getRenderer()->render();
+    return true;
+}
+
+Rect CardFaceCache::getSlotRect(int slot) const
+{
+    float cellWidth = _cardSize.width + SLOT_PADDING * 2;
+    float cellHeight = _cardSize.height + SLOT_PADDING * 2;
+    float x = (slot % SLOT_COLUMNS) * cellWidth + SLOT_PADDING;
+    float y = (slot / SLOT_COLUMNS) * cellHeight + SLOT_PADDING;
+    return Rect(x, y, _cardSize.width, _cardSize.height);
+}
+
+SpriteFrame* CardFaceCache::getFrame(CardFaceType face, CardSuitType suit, bool flipped)
+{
+    if (!flipped) return getBackFrame();
+    int faceIndex = static_cast<int>(face);
+    int suitIndex = static_cast<int>(suit);
+    if (faceIndex < 0 || faceIndex >= 13 || suitIndex < 0 || suitIndex >= 4) return getBackFrame();
+    // 与 CardModel::getKindIndex 一致
+    return getSlotFrame(suitIndex * 13 + faceIndex);
+}
+
+SpriteFrame* CardFaceCache::getBackFrame()
+{
+    return getSlotFrame(BACK_SLOT);
+}
+
+void CardFaceCache::warmUp()
+{
+    for (int slot = 0; slot < SLOT_COUNT; slot++) getSlotFrame(slot);
+}
+
+bool CardFaceCache::warmUpStep(int maxSlots)
+{
+    for (int slot = 0; slot < SLOT_COUNT && maxSlots > 0; slot++) {
+        if (_composed.test(slot)) continue;
+        if (!getSlotFrame(slot)) return true; // 渲染纹理创建失败，取用时再退回
+        maxSlots--;
+    }
+    return _composed.all();
+}
+
+SpriteFrame* CardFaceCache::getSlotFrame(int slot)
+{
+    if (!ensureTexture()) return nullptr;
+    if (!_composed.test(slot)) {
+        composeSlot(slot);
+        _composed.set(slot);
+    }
+    if (!_frames[slot]) {
+        _frames[slot] = SpriteFrame::createWithTexture(_renderTexture->getSprite()->getTexture(), getSlotRect(slot));
+        _frames[slot]->retain();
+    }
+    return _frames[slot];
+}
+
+void CardFaceCache::composeSlot(int slot)
+{
+    Node* content = slot == BACK_SLOT
+        ? createBackNode()
+        : createFaceNode(static_cast<CardFaceType>(slot % 13), static_cast<CardSuitType>(slot / 13));
+
+    // 渲染纹理的行序与图片相反（GL 原点在左下），上下翻转后绘制，帧矩形即可按常规图片坐标取
+    Rect rect = getSlotRect(slot);
+    content->setScaleY(-1.0f);
+    content->setPosition(Vec2(rect.origin.x, rect.origin.y + rect.size.height));
+
+    // 在逻辑阶段立即提交渲染，合成用的临时节点随后即可释放
+    _renderTexture->begin();
+    content->visit();
+    _renderTexture->end();
+    Director::getInstance()->getRenderer()->render();
+}
+
+Node* CardFaceCache::createFaceNode(CardFaceType face, CardSuitType suit)
+{
+    Node* root = Node::create();
+    root->addChild(createBackground(Color4F(1, 1, 1, 1)));
+
+    int faceValue = static_cast<int>(face) + 1;
+    bool red = isRedSuit(suit);
+    float width = _cardSize.width;
+    float height = _cardSize.height;
+
+    // 中间大数字
+    Sprite* bigFace = createImageSprite(numberFile(true, red, faceValue));
+    if (bigFace) {
+        bigFace->setPosition(Vec2(width / 2, height / 2));
+        root->addChild(bigFace);
+    } else {
+        auto label = Label::createWithSystemFont(StringUtils::format("%d", faceValue), "Arial", 36);
+        label->setPosition(Vec2(width / 2, height / 2));
+        label->setTextColor(red ? Color4B::RED : Color4B::BLACK);
+        root->addChild(label);
+    }
+
+    // 左上角小数字
+    Sprite* smallFace = createImageSprite(numberFile(false, red, faceValue));
+    if (smallFace) {
+        smallFace->setPosition(Vec2(25, height - 25));
+        root->addChild(smallFace);
+    }
+
+    // 右上角花色
+    const char* suitFilename = suitFile(suit);
+    Sprite* suitSprite = suitFilename ? createImageSprite(suitFilename) : nullptr;
+    if (suitSprite) {
+        suitSprite->setPosition(Vec2(width - 25, height - 25));
+        root->addChild(suitSprite);
+    }
+    return root;
+}
+
+Node* CardFaceCache::createBackNode()
+{
+    Node* root = Node::create();
+    root->addChild(createBackground(Color4F(0.3f, 0.3f, 0.5f, 1.0f)));
+    return root;
+}
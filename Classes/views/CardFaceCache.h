@@ -0,0 +1,86 @@
+#pragma once
+#ifndef CARD_FACE_CACHE_H
+#define CARD_FACE_CACHE_H
+
+#include "cocos2d.h"
+#include "../models/CardDefines.h"
+#include <bitset>
+
+/**
+ * 卡牌牌面缓存
+ * 52 种牌面（花色 x 点数）与牌背各占 RenderTexture 上的一个格子，
+ * 每种牌面在第一次用到时把底图、大数字、小数字、花色合成进对应格子，之后只返回 SpriteFrame。
+ * 所有卡牌因此都是同一张纹理上的单个精灵，节点数约为逐层拼装的 1/4，且可整体合批。
+ * 合成的素材优先取卡牌图集（res/cards.plist），缺失时按文件名加载或用纯色与文字替代。
+ */
+class CardFaceCache
+{
+public:
+    // 卡牌素材图集（tools/atlas/pack_card_atlas.py 生成），帧名即原图路径
+    static const char* const ATLAS_PLIST;
+    static const char* const ATLAS_TEXTURE;
+
+    static CardFaceCache* getInstance();
+    static void destroyInstance();
+
+    /**
+     * 启动时把卡牌素材图集载入 SpriteFrameCache
+     * @return 图集缺失时返回 false，合成时退回逐文件加载
+     */
+    static bool preloadAtlas();
+
+    /**
+     * preloadAtlas 的异步版本：经 TextureCache::addImageAsync 在后台线程解码卡牌素材纹理，
+     * 图集存在时载入图集纹理并登记 SpriteFrameCache，否则载入逐个素材文件；
+     * 全部完成后在主线程回调，参数为图集是否可用
+     */
+    static void preloadTexturesAsync(const std::function<void(bool)>& callback);
+
+    /**
+     * 取牌面帧，首次请求时合成
+     * @param flipped false 时返回牌背
+     */
+    cocos2d::SpriteFrame* getFrame(CardFaceType face, CardSuitType suit, bool flipped);
+
+    cocos2d::SpriteFrame* getBackFrame();
+
+    // 预先合成全部牌面（加载阶段调用，避免对局中首次出现某张牌时的合成开销）
+    void warmUp();
+
+    /**
+     * 分帧预合成：合成至多 maxSlots 个尚未合成的牌面
+     * @return 全部牌面都已合成时返回 true
+     */
+    bool warmUpStep(int maxSlots);
+
+    // 已合成的牌面比例（0 ~ 1）
+    float getWarmUpProgress() const { return static_cast<float>(_composed.count()) / SLOT_COUNT; }
+
+    // 单张牌的尺寸
+    const cocos2d::Size& getCardSize() const { return _cardSize; }
+
+private:
+    static const int FACE_SLOT_COUNT = 52;          // 花色 x 点数
+    static const int BACK_SLOT = FACE_SLOT_COUNT;   // 牌背
+    static const int SLOT_COUNT = FACE_SLOT_COUNT + 1;
+    static const int SLOT_COLUMNS = 8;
+    static const int SLOT_PADDING = 2;
+
+    CardFaceCache();
+    ~CardFaceCache();
+
+    bool ensureTexture();
+    cocos2d::SpriteFrame* getSlotFrame(int slot);
+    void composeSlot(int slot);
+    cocos2d::Node* createFaceNode(CardFaceType face, CardSuitType suit);
+    cocos2d::Node* createBackNode();
+    cocos2d::Rect getSlotRect(int slot) const;
+
+    cocos2d::RenderTexture* _renderTexture;
+    cocos2d::SpriteFrame* _frames[SLOT_COUNT];
+    std::bitset<SLOT_COUNT> _composed;
+    cocos2d::Size _cardSize;
+    cocos2d::EventListenerCustom* _rendererRecreatedListener;
+};
+
+#endif // CARD_FACE_CACHE_H
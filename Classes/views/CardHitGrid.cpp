@@ -0,0 +1,136 @@
+#include "CardHitGrid.h"
+#include <algorithm>
+#include <cmath>
+
+CardHitGrid::CardHitGrid(float width, float height, float cellSize)
+    : _columns(std::max(1, static_cast<int>(std::ceil(width / cellSize))))
+    , _rows(std::max(1, static_cast<int>(std::ceil(height / cellSize))))
+    , _cellSize(cellSize)
+    , _nextOrder(0)
+{
+    _cells.resize(_columns * _rows);
+}
+
+void CardHitGrid::clear()
+{
+    for (auto& cell : _cells) cell.clear();
+    for (auto& entry : _entries) entry.active = false;
+    _nextOrder = 0;
+}
+
+int CardHitGrid::cellX(float x) const
+{
+    int cx = static_cast<int>(std::floor(x / _cellSize));
+    return std::min(std::max(cx, 0), _columns - 1);
+}
+
+int CardHitGrid::cellY(float y) const
+{
+    int cy = static_cast<int>(std::floor(y / _cellSize));
+    return std::min(std::max(cy, 0), _rows - 1);
+}
+
+void CardHitGrid::link(int cardId, const Entry& entry)
+{
+    for (int y = entry.cellY0; y <= entry.cellY1; y++) {
+        for (int x = entry.cellX0; x <= entry.cellX1; x++) {
+            _cells[y * _columns + x].push_back(cardId);
+        }
+    }
+}
+
+void CardHitGrid::unlink(int cardId, const Entry& entry)
+{
+    for (int y = entry.cellY0; y <= entry.cellY1; y++) {
+        for (int x = entry.cellX0; x <= entry.cellX1; x++) {
+            std::vector<int>& cell = _cells[y * _columns + x];
+            auto it = std::find(cell.begin(), cell.end(), cardId);
+            if (it != cell.end()) {
+                // 单元内无序，用末尾元素填补
+                *it = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+}
+
+void CardHitGrid::insert(int cardId, const Rect& rect)
+{
+    if (cardId < 0) return;
+    if (cardId >= static_cast<int>(_entries.size())) {
+        Entry empty = {};
+        _entries.resize(cardId + 1, empty);
+    }
+
+    Entry& entry = _entries[cardId];
+    if (entry.active) unlink(cardId, entry);
+
+    entry.rect = rect;
+    entry.order = _nextOrder++;
+    entry.cellX0 = cellX(rect.minX);
+    entry.cellY0 = cellY(rect.minY);
+    entry.cellX1 = cellX(rect.maxX);
+    entry.cellY1 = cellY(rect.maxY);
+    entry.active = true;
+    link(cardId, entry);
+}
+
+void CardHitGrid::move(int cardId, const Rect& rect)
+{
+    if (!containsCard(cardId)) {
+        insert(cardId, rect);
+        return;
+    }
+
+    Entry& entry = _entries[cardId];
+    int x0 = cellX(rect.minX), y0 = cellY(rect.minY);
+    int x1 = cellX(rect.maxX), y1 = cellY(rect.maxY);
+    // 覆盖的单元不变时只更新矩形
+    if (x0 != entry.cellX0 || y0 != entry.cellY0 || x1 != entry.cellX1 || y1 != entry.cellY1) {
+        unlink(cardId, entry);
+        entry.cellX0 = x0;
+        entry.cellY0 = y0;
+        entry.cellX1 = x1;
+        entry.cellY1 = y1;
+        link(cardId, entry);
+    }
+    entry.rect = rect;
+}
+
+void CardHitGrid::remove(int cardId)
+{
+    if (!containsCard(cardId)) return;
+    Entry& entry = _entries[cardId];
+    unlink(cardId, entry);
+    entry.active = false;
+}
+
+bool CardHitGrid::containsCard(int cardId) const
+{
+    return cardId >= 0 && cardId < static_cast<int>(_entries.size()) && _entries[cardId].active;
+}
+
+bool CardHitGrid::hitCard(int cardId, float x, float y) const
+{
+    if (!containsCard(cardId)) return false;
+    const Rect& r = _entries[cardId].rect;
+    return x >= r.minX && x <= r.maxX && y >= r.minY && y <= r.maxY;
+}
+
+int CardHitGrid::hitTest(float x, float y) const
+{
+    const std::vector<int>& cell = _cells[cellY(y) * _columns + cellX(x)];
+    int hitId = -1;
+    uint32_t hitOrder = 0;
+    for (int cardId : cell) {
+        const Entry& entry = _entries[cardId];
+        const Rect& r = entry.rect;
+        if (x >= r.minX && x <= r.maxX && y >= r.minY && y <= r.maxY) {
+            if (hitId < 0 || entry.order > hitOrder) {
+                hitId = cardId;
+                hitOrder = entry.order;
+            }
+        }
+    }
+    return hitId;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef CARD_HIT_GRID_H
+#define CARD_HIT_GRID_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * 卡牌点击检测的均匀网格索引
+ * 以卡牌ID为键保存点击矩形（父节点坐标系），每个矩形登记在它覆盖的网格单元中；
+ * 检测时只遍历触点所在单元的少数几张牌，耗时与桌面总牌数无关。
+ * 后插入的牌层级更高，与 cocos 同一父节点下按加入顺序绘制的规则一致，重叠时命中最上层。
+ * 不依赖 cocos2d-x。
+ */
+class CardHitGrid
+{
+public:
+    struct Rect
+    {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    /**
+     * @param width, height 索引覆盖的区域，超出区域的矩形归入边缘单元，仍可正确命中
+     * @param cellSize 单元边长，取与卡牌尺寸同一量级
+     */
+    CardHitGrid(float width, float height, float cellSize);
+
+    void clear();
+
+    // 加入或重新加入一张牌，置于最上层
+    void insert(int cardId, const Rect& rect);
+
+    // 移动一张牌，层级不变；牌不在索引中时等同 insert
+    void move(int cardId, const Rect& rect);
+
+    void remove(int cardId);
+
+    bool containsCard(int cardId) const;
+
+    // 点是否落在指定牌的矩形内
+    bool hitCard(int cardId, float x, float y) const;
+
+    /**
+     * 命中检测
+     * @return 覆盖该点的最上层卡牌ID，没有时返回 -1
+     */
+    int hitTest(float x, float y) const;
+
+private:
+    struct Entry
+    {
+        Rect rect;
+        uint32_t order;   // 层级，越大越靠上
+        int cellX0, cellY0, cellX1, cellY1;
+        bool active;
+    };
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+    void link(int cardId, const Entry& entry);
+    void unlink(int cardId, const Entry& entry);
+
+    std::vector<Entry> _entries;           // 以卡牌ID为下标（ID 在一局内是稠密的）
+    std::vector<std::vector<int>> _cells;  // 每个单元内的卡牌ID
+    int _columns;
+    int _rows;
+    float _cellSize;
+    uint32_t _nextOrder;
+};
+
+#endif // CARD_HIT_GRID_H
@@ -5,12 +5,9 @@
 #include "cocos2d.h"
 #include "../models/CardModel.h"
 
-// ǰѭ
-class CardController;
-
 /**
  * ͼ
- * ſƵʾʹ¼
+ * ſƵʾ GameView ͳһص
  */
 class CardView : public cocos2d::Node
 {
@@ -20,53 +17,35 @@ public:
     virtual bool init() override;
 
     /**
-     * ͼʾ
+     * ͼ󶨵һſƣ½ûʱã
+     * ֻлΨһʾ֡ CardFaceCacheɾڵ
      * @param cardModel ģ
      */
-    void updateView(const CardModel* cardModel);
+    void rebind(const CardModel* cardModel);
 
     /**
-     * ÿƵص
-     * @param callback صΪID
+     * ǰʾ棨ɫ棩Ƿģһ
+     * һʱֻͬλãذ
      */
-    void setClickCallback(const std::function<void(int)>& callback) { _clickCallback = callback; }
+    bool isShowing(const CardModel* cardModel) const;
 
     /**
-     * ƶ
-     * @param targetPosition Ŀλ
-     * @param duration ʱ
-     * @param callback ɺĻص
+     * յǰλָֹͣɫ
      */
-    void playMoveAnimation(const cocos2d::Vec2& targetPosition, float duration, const std::function<void()>& callback = nullptr);
+    void resetForReuse();
 
-    /**
-     * ƥ
-     * @param callback ɺĻص
-     */
-    void playMatchAnimation(const std::function<void()>& callback = nullptr);
+    // ʱĸɫ
+    void setHighlighted(bool highlighted);
 
-    /**
-     * ÿǷɵ
-     * @param enabled Ƿɵ
-     */
-    void setTouchEnabled(bool enabled);
-
-    /**
-     * ÿǷ񷭿
-     * @param flipped Ƿ񷭿
-     */
-    void setFlipped(bool flipped) { _flipped = flipped; }
+    // ƾߴ磨δţ
+    cocos2d::Size getCardSize() const;
 
 private:
-    void setupTouchHandling();
-    void onTouched();
-
-    cocos2d::Sprite* _cardSprite; // ƾ
-    cocos2d::Sprite* _faceSprite; // ֺͻɫ
-    cocos2d::Sprite* _suitSprite; // ɫ飨Ҫֿʾ
-    std::function<void(int)> _clickCallback; // ص
+    cocos2d::Sprite* _cardSprite; // ƾ飨棩
     int _cardId; // ID
     bool _flipped; // Ƿ񷭿 
+    CardFaceType _face; // ǰʾĵ
+    CardSuitType _suit; // ǰʾĻɫ
 };
 
 #endif // CARD_VIEW_H
\ No newline at end of file
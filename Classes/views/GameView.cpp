@@ -1,27 +1,70 @@
 #include "GameView.h"
 #include "models/GameModel.h"
 #include "models/CardModel.h"
+#include "utils/EventLog.h"
+#include "utils/Trace.h"
+#include "managers/FrameRateManager.h"
 
 USING_NS_CC;
 
+namespace {
+    const float PLAYFIELD_WIDTH = 1080.0f;
+    const float PLAYFIELD_HEIGHT = 1500.0f;
+    const float HIT_CELL_SIZE = 160.0f;   // 与卡牌宽度同一量级，每个单元通常只有几张牌
+    const float HIT_PADDING = 20.0f;      // 点击容差
+}
+
 GameView* GameView::create() {
     GameView* pRet = new GameView();
     if (pRet && pRet->init()) { pRet->autorelease(); return pRet; }
     delete pRet; return nullptr;
 }
 
+GameView::GameView()
+    : _playFieldNode(nullptr)
+    , _bottomNode(nullptr)
+    , _drawAreaNode(nullptr)
+    , _touchListener(nullptr)
+    , _hitGrid(PLAYFIELD_WIDTH, PLAYFIELD_HEIGHT, HIT_CELL_SIZE)
+    , _pressedCardId(-1)
+    , _drawAreaPressed(false)
+{
+    _tween.cardId = -1;
+    _tween.elapsed = 0;
+    _tween.duration = 0;
+}
+
 bool GameView::init() {
     if (!Node::init()) return false;
     setupUI();
+    scheduleUpdate();
     return true;
 }
 
+void GameView::update(float dt) {
+    if (_tween.cardId < 0) return;
+
+    CardView* cv = getCardView(_tween.cardId);
+    if (!cv) {
+        _tween.cardId = -1;
+        return;
+    }
+    // 逐帧插值不是 Action，播放期间须保持满帧率
+    FrameRateManager::getInstance()->keepAwake();
+    _tween.elapsed += dt;
+    if (_tween.elapsed >= _tween.duration) {
+        finishCardTransition();
+        return;
+    }
+    cv->setPosition(_tween.from.lerp(_tween.to, _tween.elapsed / _tween.duration));
+}
+
 void GameView::setupUI() {
     _playFieldNode = Node::create();
     _bottomNode = Node::create();
     _drawAreaNode = Node::create();
 
-    auto playFieldBg = LayerColor::create(Color4B{30, 45, 30, 255}, 1080, 1500);
+    auto playFieldBg = LayerColor::create(Color4B{30, 45, 30, 255}, PLAYFIELD_WIDTH, PLAYFIELD_HEIGHT);
     _playFieldNode->addChild(playFieldBg, -1);
 
     auto goldTop = LayerColor::create(Color4B{180, 160, 60, 180}, 1080, 2);
@@ -66,73 +109,188 @@ void GameView::setupUI() {
     drawLabel->setTextColor(Color4B{150, 200, 255, 255});
     _drawAreaNode->addChild(drawLabel);
 
-    setupDrawAreaTouch();
+    setupTouchHandling();
 }
 
-void GameView::setupDrawAreaTouch()
+void GameView::setupTouchHandling()
 {
-    if (_drawAreaTouchListener) {
-        _eventDispatcher->removeEventListener(_drawAreaTouchListener);
-        _drawAreaTouchListener = nullptr;
-    }
-    _drawAreaTouchListener = EventListenerTouchOneByOne::create();
-    _drawAreaTouchListener->setSwallowTouches(true);
+    // 整个视图只注册一个监听器，桌面牌由网格索引命中，不随卡牌数量增加监听器
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(true);
+
+    _touchListener->onTouchBegan = [this](Touch* touch, Event* event) -> bool {
+        _pressedCardId = -1;
+        _drawAreaPressed = false;
+        if (hitDrawArea(touch->getLocation())) {
+            _drawAreaPressed = true;
+            return true;
+        }
 
-    _drawAreaTouchListener->onTouchBegan = [this](Touch* touch, Event* event) -> bool {
-        if (!_drawAreaNode || !_drawAreaNode->isVisible()) return false;
-        Vec2 loc = _drawAreaNode->convertToNodeSpace(touch->getLocation());
-        return Rect(-90, -130, 180, 260).containsPoint(loc);
+        Vec2 loc = _playFieldNode->convertToNodeSpace(touch->getLocation());
+        int cardId = _hitGrid.hitTest(loc.x, loc.y);
+        if (cardId < 0) return false;
+        _pressedCardId = cardId;
+        setCardHighlighted(cardId, true);
+        return true;
     };
 
-    _drawAreaTouchListener->onTouchEnded = [this](Touch* touch, Event* event) {
-        CCLOG("GameView: DRAW area clicked!");
-        if (_drawAreaClickCallback) _drawAreaClickCallback();
+    _touchListener->onTouchMoved = [this](Touch* touch, Event* event) {
+        if (_pressedCardId < 0) return;
+        Vec2 loc = _playFieldNode->convertToNodeSpace(touch->getLocation());
+        setCardHighlighted(_pressedCardId, _hitGrid.hitCard(_pressedCardId, loc.x, loc.y));
     };
 
-    _eventDispatcher->addEventListenerWithSceneGraphPriority(_drawAreaTouchListener, _drawAreaNode);
+    _touchListener->onTouchEnded = [this](Touch* touch, Event* event) {
+        if (_drawAreaPressed) {
+            _drawAreaPressed = false;
+            EVENT_LOG(VIEW_DRAW_AREA_CLICKED);
+            if (_drawAreaClickCallback) _drawAreaClickCallback();
+            return;
+        }
+        if (_pressedCardId < 0) return;
+
+        int cardId = _pressedCardId;
+        _pressedCardId = -1;
+        setCardHighlighted(cardId, false);
+
+        // 只有在松开时手指仍在卡牌区域才触发点击
+        Vec2 loc = _playFieldNode->convertToNodeSpace(touch->getLocation());
+        if (_hitGrid.hitCard(cardId, loc.x, loc.y) && _cardClickCallback) {
+            _cardClickCallback(cardId);
+        }
+    };
+
+    _touchListener->onTouchCancelled = [this](Touch* touch, Event* event) {
+        if (_pressedCardId >= 0) setCardHighlighted(_pressedCardId, false);
+        _pressedCardId = -1;
+        _drawAreaPressed = false;
+    };
+
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(_touchListener, this);
+}
+
+bool GameView::hitDrawArea(const Vec2& worldLocation) const
+{
+    if (!_drawAreaNode || !_drawAreaNode->isVisible()) return false;
+    Vec2 loc = _drawAreaNode->convertToNodeSpace(worldLocation);
+    return Rect(-90, -130, 180, 260).containsPoint(loc);
+}
+
+void GameView::setCardHighlighted(int cardId, bool highlighted)
+{
+    CardView* cv = getCardView(cardId);
+    if (cv) cv->setHighlighted(highlighted);
+}
+
+CardHitGrid::Rect GameView::makeHitRect(const Vec2& position, CardView* cardView) const
+{
+    // 卡牌锚点在中心，矩形四周扩大容差
+    Size size = cardView->getCardSize() * cardView->getScale();
+    float halfWidth = size.width / 2 + HIT_PADDING;
+    float halfHeight = size.height / 2 + HIT_PADDING;
+    CardHitGrid::Rect rect = { position.x - halfWidth, position.y - halfHeight, position.x + halfWidth, position.y + halfHeight };
+    return rect;
 }
 
 void GameView::updateView(GameModel* gameModel) {
     if (!gameModel) return;
+    TRACE_SCOPE("GameView::updateView");
 
-    std::vector<Node*> nodesToRemove;
-    for (auto child : _playFieldNode->getChildren())
-        if (dynamic_cast<CardView*>(child)) nodesToRemove.push_back(child);
-    for (auto child : _bottomNode->getChildren())
-        if (dynamic_cast<CardView*>(child)) nodesToRemove.push_back(child);
-    // DRAW 区不管理 CardView，不需要清理
-
-    for (auto node : nodesToRemove) node->removeFromParent();
-    _cardViews.clear();
+    // 按卡牌ID对比现有视图：只销毁离开桌面/底牌区的牌，其余视图原地保留
+    for (auto it = _cardViews.begin(); it != _cardViews.end();) {
+        CardModel* cardModel = gameModel->getCardById(it->first);
+        GameAreaType area = cardModel ? cardModel->getArea() : GameAreaType::NONE;
+        if (area != GameAreaType::PLAY_FIELD && area != GameAreaType::BOTTOM) {
+            releaseCardView(it->first, it->second);
+            it = _cardViews.erase(it);
+        } else {
+            ++it;
+        }
+    }
 
     // 桌面卡牌
     for (auto cardModel : gameModel->getPlayFieldCards()) {
-        if (cardModel) {
-            CardView* cv = CardView::create();
-            if (cv) {
-                cv->updateView(cardModel);
-                cv->setClickCallback(_cardClickCallback);
-                _cardViews[cardModel->getCardId()] = cv;
-                _playFieldNode->addChild(cv);
-            }
-        }
+        if (cardModel) syncCardView(cardModel, _playFieldNode, 1.0f, true);
     }
 
     // 底牌
     CardModel* bc = gameModel->getBottomCard();
-    if (bc) {
-        CardView* cv = CardView::create();
-        if (cv) {
-            bc->setFlipped(true);
-            cv->updateView(bc);
-            cv->setScale(1.1f);
-            _cardViews[bc->getCardId()] = cv;
-            _bottomNode->addChild(cv);
+    if (bc) syncCardView(bc, _bottomNode, 1.1f, false);
+
+    // DRAW 区：只保留装饰背景和标签，不添加任何 CardView
+    // 点击事件由 setupTouchHandling 的监听器直接处理
+}
+
+void GameView::syncCardView(CardModel* cardModel, Node* parent, float scale, bool clickable) {
+    int cardId = cardModel->getCardId();
+    CardView* cv = getCardView(cardId);
+    bool raised = false; // 新加入父节点的视图绘制在最上层，点击索引同样置顶
+
+    if (!cv) {
+        // 新出现的牌：优先从对象池取
+        cv = acquireCardView(parent);
+        if (!cv) return;
+        cv->rebind(cardModel);
+        _cardViews[cardId] = cv;
+        raised = true;
+    } else {
+        if (cv->getParent() != parent) {
+            // 换区（如桌面牌成为底牌）：挂到新父节点
+            cv->retain();
+            cv->removeFromParentAndCleanup(false);
+            parent->addChild(cv);
+            cv->release();
+            raised = true;
+        }
+
+        if (!cv->isShowing(cardModel)) {
+            // 牌面或翻面状态变化（如重开一局后同一ID对应新牌）才重绑纹理
+            cv->rebind(cardModel);
+        } else {
+            const CardPosition& position = cardModel->getPosition();
+            Vec2 target(position.x, position.y);
+            if (!cv->getPosition().equals(target)) cv->setPosition(target);
         }
     }
 
-    // DRAW 区：只保留装饰背景和标签，不添加任何 CardView
-    // 点击事件由 setupDrawAreaTouch 的监听器直接处理
+    if (cv->getScale() != scale) cv->setScale(scale);
+
+    // 点击索引按模型位置（动画终点）登记，位置未变时 move 只比较单元范围
+    if (clickable) {
+        const CardPosition& position = cardModel->getPosition();
+        CardHitGrid::Rect rect = makeHitRect(Vec2(position.x, position.y), cv);
+        if (raised) _hitGrid.insert(cardId, rect);
+        else _hitGrid.move(cardId, rect);
+    } else {
+        _hitGrid.remove(cardId);
+    }
+}
+
+CardView* GameView::acquireCardView(Node* parent) {
+    // 先挂到父节点再出池，全程有持有者，不经过 autorelease
+    CardView* cv = nullptr;
+    if (_cardViewPool.empty()) {
+        cv = CardView::create();
+        if (!cv) return nullptr;
+        parent->addChild(cv);
+    } else {
+        cv = _cardViewPool.back();
+        parent->addChild(cv);
+        _cardViewPool.popBack();
+    }
+    return cv;
+}
+
+void GameView::releaseCardView(int cardId, CardView* cardView) {
+    _hitGrid.remove(cardId);
+    if (_pressedCardId == cardId) _pressedCardId = -1;
+    // 过渡中的牌被后续操作顶走：过渡作废，由控制器继续下一个
+    if (_tween.cardId == cardId) _tween.cardId = -1;
+
+    // 先由对象池持有，再从父节点摘下
+    _cardViewPool.pushBack(cardView);
+    cardView->removeFromParentAndCleanup(false);
+    cardView->resetForReuse();
 }
 
 CardView* GameView::getCardView(int cardId) const {
@@ -140,14 +298,40 @@ CardView* GameView::getCardView(int cardId) const {
     return (it != _cardViews.end()) ? it->second : nullptr;
 }
 
-void GameView::playMatchAnimation(int cardId, const std::function<void()>& callback) {
+bool GameView::playCardTransition(int cardId, const Vec2& fromWorld, float duration) {
+    cancelCardTransition();
+
     CardView* cv = getCardView(cardId);
-    if (cv) cv->playMatchAnimation(callback);
-    else if (callback) callback();
+    if (!cv || !cv->getParent() || duration <= 0) return false;
+
+    _tween.cardId = cardId;
+    _tween.to = cv->getPosition();
+    _tween.from = cv->getParent()->convertToNodeSpace(fromWorld);
+    _tween.elapsed = 0;
+    _tween.duration = duration;
+    cv->setPosition(_tween.from);
+    return true;
 }
 
-void GameView::playCardMoveAnimation(int cardId, const cocos2d::Vec2& tp, float dur, const std::function<void()>& callback) {
-    CardView* cv = getCardView(cardId);
-    if (cv) cv->playMoveAnimation(tp, dur, callback);
-    else if (callback) callback();
+void GameView::finishCardTransition() {
+    if (_tween.cardId < 0) return;
+    TRACE_SCOPE_VALUE("GameView::finishCardTransition", _tween.cardId);
+    cancelCardTransition();
+    // 先清空状态再回调，回调里可以直接开始下一个过渡
+    if (_transitionFinishedCallback) _transitionFinishedCallback();
+}
+
+void GameView::cancelCardTransition() {
+    if (_tween.cardId < 0) return;
+    CardView* cv = getCardView(_tween.cardId);
+    if (cv) cv->setPosition(_tween.to);
+    _tween.cardId = -1;
+}
+
+Vec2 GameView::getPlayFieldWorldPosition(const CardPosition& position) const {
+    return _playFieldNode->convertToWorldSpace(Vec2(position.x, position.y));
+}
+
+Vec2 GameView::getDrawAreaWorldPosition() const {
+    return _drawAreaNode->convertToWorldSpace(Vec2::ZERO);
 }
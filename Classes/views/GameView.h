@@ -4,6 +4,7 @@
 
 #include "cocos2d.h"
 #include "CardView.h"
+#include "CardHitGrid.h"
 
 class GameModel;
 
@@ -11,7 +12,9 @@ class GameView : public cocos2d::Node
 {
 public:
     static GameView* create();
+    GameView();
     virtual bool init() override;
+    virtual void update(float dt) override;
 
     void updateView(GameModel* gameModel);
 
@@ -25,8 +28,26 @@ public:
     }
 
     CardView* getCardView(int cardId) const;
-    void playMatchAnimation(int cardId, const std::function<void()>& callback = nullptr);
-    void playCardMoveAnimation(int cardId, const cocos2d::Vec2& targetPosition, float duration, const std::function<void()>& callback = nullptr);
+
+    /**
+     * 过渡动画：cardId 的视图已由 updateView 放到模型位置（终点），从世界坐标 fromWorld 处飞回终点
+     * 同一时间只播放一个过渡，逐帧插值，不创建 Action；播完调用过渡完成回调
+     * @return 视图不存在或时长不大于 0 时不播放并返回 false
+     */
+    bool playCardTransition(int cardId, const cocos2d::Vec2& fromWorld, float duration);
+    // 当前过渡立即跳到终点并调用完成回调
+    void finishCardTransition();
+    // 当前过渡立即跳到终点，不调用回调（撤销、重开时整体重置）
+    void cancelCardTransition();
+    bool isCardTransitionPlaying() const { return _tween.cardId >= 0; }
+
+    void setCardTransitionFinishedCallback(const std::function<void()>& callback) {
+        _transitionFinishedCallback = callback;
+    }
+
+    // 桌面位置、抽牌区在世界坐标系下的位置，作为过渡起点
+    cocos2d::Vec2 getPlayFieldWorldPosition(const CardPosition& position) const;
+    cocos2d::Vec2 getDrawAreaWorldPosition() const;
 
     cocos2d::Vec2 getBottomNodePosition() const { return _bottomNode->getPosition(); }
     cocos2d::Vec2 getDrawAreaNodePosition() const { return _drawAreaNode->getPosition(); }
@@ -37,18 +58,49 @@ public:
 
 private:
     void setupUI();
-    void setupDrawAreaTouch();
+    void setupTouchHandling();
     void createCardView(CardModel* cardModel);
 
+    bool hitDrawArea(const cocos2d::Vec2& worldLocation) const;
+    void setCardHighlighted(int cardId, bool highlighted);
+
+    // 卡牌视图在父节点坐标系下的点击矩形（含容差）
+    CardHitGrid::Rect makeHitRect(const cocos2d::Vec2& position, CardView* cardView) const;
+
+    // 让 cardModel 的视图挂在 parent 下并与模型一致，已有视图只做最小更新
+    void syncCardView(CardModel* cardModel, cocos2d::Node* parent, float scale, bool clickable);
+
+    // 从对象池取一个卡牌视图挂到 parent 下，池空时新建
+    CardView* acquireCardView(cocos2d::Node* parent);
+    // 把离场的卡牌视图摘下并放回对象池
+    void releaseCardView(int cardId, CardView* cardView);
+
     std::unordered_map<int, CardView*> _cardViews;
+    cocos2d::Vector<CardView*> _cardViewPool; // 离场卡牌视图的对象池（持有引用）
     std::function<void(int)> _cardClickCallback;
     std::function<void()> _drawAreaClickCallback;
+    std::function<void()> _transitionFinishedCallback;
+
+    // 正在播放的过渡（父节点坐标系），cardId 为 -1 表示空闲
+    struct CardTween
+    {
+        int cardId;
+        cocos2d::Vec2 from;
+        cocos2d::Vec2 to;
+        float elapsed;
+        float duration;
+    };
+    CardTween _tween;
 
     cocos2d::Node* _playFieldNode;
     cocos2d::Node* _bottomNode;
     cocos2d::Node* _drawAreaNode; // 统一的抽牌/换牌区
 
-    cocos2d::EventListenerTouchOneByOne* _drawAreaTouchListener;
+    // 唯一的触摸监听器：抽牌区 + 网格索引命中的桌面牌
+    cocos2d::EventListenerTouchOneByOne* _touchListener;
+    CardHitGrid _hitGrid;    // 桌面可点击卡牌的点击矩形（桌面节点坐标系）
+    int _pressedCardId;      // 按下的桌面牌，无则为 -1
+    bool _drawAreaPressed;
 };
 
 #endif
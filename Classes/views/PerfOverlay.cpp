@@ -0,0 +1,194 @@
+#include "PerfOverlay.h"
+#include "utils/AllocCounter.h"
+#include "utils/Trace.h"
+#include "managers/FrameRateManager.h"
+#include <algorithm>
+#include <cstdio>
+
+USING_NS_CC;
+
+namespace {
+    const float REFRESH_INTERVAL = 0.25f;       // 文字与柱状图的刷新间隔
+    const float TEXTURE_REFRESH_INTERVAL = 1.0f; // 纹理内存统计要遍历纹理缓存，降低频率
+    const float GRAPH_HEIGHT = 120.0f;
+    const float GRAPH_SCALE_MS = 50.0f;         // 柱状图满高对应的帧间隔
+    const float BUDGET_60_MS = 1000.0f / 60;
+    const float BUDGET_30_MS = 1000.0f / 30;
+
+    int countNodes(Node* node)
+    {
+        int count = 1;
+        for (Node* child : node->getChildren()) count += countNodes(child);
+        return count;
+    }
+
+    // TextureCache::getCachedTextureInfo 末行为 "... for N KB (x MB)"
+    float parseTextureMegabytes(const std::string& info)
+    {
+        size_t pos = info.rfind(" for ");
+        unsigned long kilobytes = 0;
+        if (pos == std::string::npos || std::sscanf(info.c_str() + pos, " for %lu KB", &kilobytes) != 1) return 0.0f;
+        return kilobytes / 1024.0f;
+    }
+}
+
+PerfOverlay* PerfOverlay::create() {
+    PerfOverlay* pRet = new PerfOverlay();
+    if (pRet && pRet->init()) { pRet->autorelease(); return pRet; }
+    delete pRet; return nullptr;
+}
+
+PerfOverlay::PerfOverlay()
+    : _lastDrawEndNs(0)
+    , _updateStartNs(0)
+    , _lastAllocations(0)
+    , _drawCalls(0)
+    , _maxDrawCalls(0)
+    , _textureMegabytes(0)
+    , _textureRefreshElapsed(TEXTURE_REFRESH_INTERVAL)
+    , _beforeUpdateListener(nullptr)
+    , _afterDrawListener(nullptr)
+    , _graph(nullptr)
+    , _text(nullptr)
+{
+}
+
+bool PerfOverlay::init() {
+    if (!Node::init()) return false;
+
+    auto background = LayerColor::create(Color4B{0, 0, 0, 170}, PANEL_WIDTH, PANEL_HEIGHT);
+    addChild(background);
+
+    _graph = DrawNode::create();
+    _graph->setPosition(Vec2(10, 10));
+    addChild(_graph);
+
+    _text = Label::createWithSystemFont("", "Courier", 20);
+    _text->setAnchorPoint(Vec2(0, 1));
+    _text->setPosition(Vec2(10, PANEL_HEIGHT - 8));
+    _text->setTextColor(Color4B::WHITE);
+    addChild(_text);
+
+    Node::setVisible(false);
+    return true;
+}
+
+void PerfOverlay::onEnter() {
+    Node::onEnter();
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    _beforeUpdateListener = dispatcher->addCustomEventListener(Director::EVENT_BEFORE_UPDATE,
+        [this](EventCustom*) { onBeforeUpdate(); });
+    _afterDrawListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW,
+        [this](EventCustom*) { onAfterDraw(); });
+    schedule(CC_SCHEDULE_SELECTOR(PerfOverlay::refresh), REFRESH_INTERVAL);
+}
+
+void PerfOverlay::onExit() {
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    dispatcher->removeEventListener(_beforeUpdateListener);
+    dispatcher->removeEventListener(_afterDrawListener);
+    _beforeUpdateListener = nullptr;
+    _afterDrawListener = nullptr;
+    unschedule(CC_SCHEDULE_SELECTOR(PerfOverlay::refresh));
+    Node::onExit();
+}
+
+void PerfOverlay::setVisible(bool visible) {
+    if (visible && !isVisible()) {
+        // 重新显示时从头统计，隐藏期间的间隔不计入
+        _stats.reset();
+        _lastDrawEndNs = 0;
+        _updateStartNs = 0;
+        _maxDrawCalls = 0;
+        _textureRefreshElapsed = TEXTURE_REFRESH_INTERVAL;
+    }
+    Node::setVisible(visible);
+    if (visible) refresh(0);
+}
+
+void PerfOverlay::onBeforeUpdate() {
+    if (!isVisible()) return;
+    _updateStartNs = Trace::nowNs();
+}
+
+void PerfOverlay::onAfterDraw() {
+    if (!isVisible()) return;
+    // 显示期间保持满帧率，否则空闲降帧的间隔会混进帧耗时统计
+    FrameRateManager::getInstance()->keepAwake();
+    uint64_t now = Trace::nowNs();
+    uint64_t allocations = AllocCounter::getAllocationCount();
+    _drawCalls = static_cast<int>(Director::getInstance()->getRenderer()->getDrawnBatches());
+    _maxDrawCalls = std::max(_maxDrawCalls, _drawCalls);
+
+    if (_lastDrawEndNs != 0) {
+        float frameMs = (now - _lastDrawEndNs) / 1e6f;
+        float workMs = _updateStartNs != 0 ? (now - _updateStartNs) / 1e6f : 0.0f;
+        _stats.addFrame(frameMs, workMs, static_cast<int>(allocations - _lastAllocations));
+    }
+    _lastDrawEndNs = now;
+    _updateStartNs = 0;
+    _lastAllocations = allocations;
+}
+
+void PerfOverlay::refresh(float dt) {
+    if (!isVisible()) return;
+
+    _textureRefreshElapsed += dt;
+    if (_textureRefreshElapsed >= TEXTURE_REFRESH_INTERVAL) {
+        _textureRefreshElapsed = 0;
+        _textureMegabytes = parseTextureMegabytes(Director::getInstance()->getTextureCache()->getCachedTextureInfo());
+    }
+    Scene* scene = Director::getInstance()->getRunningScene();
+    int nodeCount = scene ? countNodes(scene) : 0;
+
+    FrameStats::Summary summary = _stats.summarize();
+    char allocText[48];
+    if (AllocCounter::isEnabled()) {
+        std::snprintf(allocText, sizeof(allocText), "%.1f avg  %d max", summary.averageAllocations, summary.maxAllocations);
+    } else {
+        std::snprintf(allocText, sizeof(allocText), "n/a (ALLOC_COUNTER_ENABLED=0)");
+    }
+    char buf[512];
+    std::snprintf(buf, sizeof(buf),
+        "frame ms  p50 %.1f  p95 %.1f  p99 %.1f  max %.1f\n"
+        "work  ms  max %.1f   (%d frames)\n"
+        "tap frames  %d  p95 %.1f  max %.1f\n"
+        "nodes %d  draws %d (max %d)  tex %.1f MB\n"
+        "alloc/frame  %s",
+        summary.p50, summary.p95, summary.p99, summary.maxMs,
+        summary.maxWorkMs, summary.frameCount,
+        summary.modelFrameCount, summary.modelP95, summary.modelMaxMs,
+        nodeCount, _drawCalls, _maxDrawCalls, _textureMegabytes,
+        allocText);
+    _text->setString(buf);
+    _maxDrawCalls = _drawCalls;
+
+    drawGraph();
+}
+
+void PerfOverlay::drawGraph() {
+    _graph->clear();
+    const float width = PANEL_WIDTH - 20.0f;
+    const float barWidth = width / GRAPH_FRAMES;
+    const float msToHeight = GRAPH_HEIGHT / GRAPH_SCALE_MS;
+
+    // 60fps 与 30fps 预算线
+    _graph->drawLine(Vec2(0, BUDGET_60_MS * msToHeight), Vec2(width, BUDGET_60_MS * msToHeight), Color4F(0.3f, 0.9f, 0.3f, 0.6f));
+    _graph->drawLine(Vec2(0, BUDGET_30_MS * msToHeight), Vec2(width, BUDGET_30_MS * msToHeight), Color4F(0.9f, 0.7f, 0.2f, 0.6f));
+
+    int count = _stats.getFrameCount();
+    int first = count > GRAPH_FRAMES ? count - GRAPH_FRAMES : 0;
+    for (int i = first; i < count; i++) {
+        const FrameSample& sample = _stats.getFrame(i);
+        float x = (i - first) * barWidth;
+        float height = std::min(sample.frameMs, GRAPH_SCALE_MS) * msToHeight;
+        Color4F color = sample.frameMs <= BUDGET_60_MS * 1.1f ? Color4F(0.3f, 0.8f, 0.3f, 0.9f)
+            : sample.frameMs <= BUDGET_30_MS * 1.1f ? Color4F(0.9f, 0.7f, 0.2f, 0.9f)
+            : Color4F(0.95f, 0.25f, 0.2f, 0.9f);
+        _graph->drawSolidRect(Vec2(x, 0), Vec2(x + barWidth * 0.8f, height), color);
+        // 模型提交后的帧：柱顶上方标一个青色方块
+        if (sample.afterModelUpdate) {
+            _graph->drawSolidRect(Vec2(x, height + 2), Vec2(x + barWidth * 0.8f, height + 8), Color4F(0.2f, 0.9f, 1.0f, 1.0f));
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef PERF_OVERLAY_H
+#define PERF_OVERLAY_H
+
+#include "cocos2d.h"
+#include "../utils/FrameStats.h"
+
+/**
+ * 性能浮层
+ * 取代只显示平均帧率的 setDisplayStats：最近约 10 秒的帧间隔分位数（p50/p95/p99/最大）、
+ * 每帧 CPU 耗时、节点数、绘制批次、纹理内存与每帧堆分配次数，下方为最近帧的柱状图。
+ * 控制器提交模型（点击、抽牌、撤销等）后的那一帧在柱状图上标出，并单独统计 p95 与最大值，
+ * 真机上即可看出点击卡顿，无需连接性能分析器。
+ * 帧的起止取自导演的帧事件；隐藏时不采样，显示时从头统计，且显示期间不降帧。
+ */
+class PerfOverlay : public cocos2d::Node
+{
+public:
+    static PerfOverlay* create();
+    PerfOverlay();
+
+    virtual bool init() override;
+    virtual void onEnter() override;
+    virtual void onExit() override;
+    virtual void setVisible(bool visible) override;
+
+    void toggle() { setVisible(!isVisible()); }
+
+    // 控制器提交模型后调用，下一帧被标记
+    void markModelUpdate() { _stats.markModelUpdate(); }
+
+private:
+    static const int GRAPH_FRAMES = 180;    // 柱状图显示的帧数
+    static const int PANEL_WIDTH = 640;
+    static const int PANEL_HEIGHT = 330;
+
+    void onBeforeUpdate();
+    void onAfterDraw();
+    void refresh(float dt);
+    void drawGraph();
+
+    FrameStats _stats;
+    uint64_t _lastDrawEndNs;     // 上一帧渲染结束时刻，0 表示尚无
+    uint64_t _updateStartNs;     // 本帧更新开始时刻，0 表示本帧未更新（导演暂停）
+    uint64_t _lastAllocations;
+    int _drawCalls;              // 最近一帧的绘制批次
+    int _maxDrawCalls;           // 两次刷新之间的最大批次
+    float _textureMegabytes;
+    float _textureRefreshElapsed;
+
+    cocos2d::EventListenerCustom* _beforeUpdateListener;
+    cocos2d::EventListenerCustom* _afterDrawListener;
+    cocos2d::DrawNode* _graph;
+    cocos2d::Label* _text;
+};
+
+#endif // PERF_OVERLAY_H
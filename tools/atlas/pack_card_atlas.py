@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""
+卡牌图集打包
+
+把 Resources/res 下的卡牌底图、数字与花色图片打成一张图集 res/cards.png 与
+cocos2d-x 格式（format 2）的 res/cards.plist。帧名沿用原图相对路径
+（如 res/number/big_red_A.png）。CardFaceCache 合成牌面时用同一个名字查 SpriteFrameCache，
+图集缺失时再按文件名单独加载；启动时由 CardFaceCache::preloadTexturesAsync 在后台载入图集纹理。
+
+只依赖 Python 3 标准库；输入须为 8 位 RGBA、非隔行的 PNG（当前资源均满足）。
+
+用法（在仓库根目录）：
+    python3 tools/atlas/pack_card_atlas.py [--resources Resources]
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+SOURCE_DIRS = ["res/card_general.png", "res/number", "res/suits"]
+ATLAS_PNG = "res/cards.png"
+ATLAS_PLIST = "res/cards.plist"
+PADDING = 2      # 帧间距
+EXTRUDE = 1      # 边缘像素外扩，避免缩放时线性过滤采到相邻帧
+MAX_SIZE = 2048
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG file" % path)
+    pos = 8
+    idat = []
+    width = height = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or color != 6 or interlace != 0:
+                raise ValueError("%s: only 8-bit non-interlaced RGBA is supported" % path)
+        elif ctype == b"IDAT":
+            idat.append(body)
+        elif ctype == b"IEND":
+            break
+
+    raw = zlib.decompress(b"".join(idat))
+    stride = width * 4
+    rows = []
+    prev = bytearray(stride)
+    offset = 0
+    for _ in range(height):
+        ftype = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        if ftype == 1:
+            for i in range(4, stride):
+                line[i] = (line[i] + line[i - 4]) & 0xFF
+        elif ftype == 2:
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xFF
+        elif ftype == 3:
+            for i in range(stride):
+                left = line[i - 4] if i >= 4 else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xFF
+        elif ftype == 4:
+            for i in range(stride):
+                a = line[i - 4] if i >= 4 else 0
+                b = prev[i]
+                c = prev[i - 4] if i >= 4 else 0
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        elif ftype != 0:
+            raise ValueError("%s: bad filter type %d" % (path, ftype))
+        rows.append(line)
+        prev = line
+    return width, height, rows
+
+
+def write_png(path, width, height, rows):
+    raw = b"".join(b"\x00" + bytes(row) for row in rows)
+
+    def chunk(ctype, body):
+        return struct.pack(">I", len(body)) + ctype + body + struct.pack(">I", zlib.crc32(ctype + body) & 0xFFFFFFFF)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def collect_sources(resources):
+    names = []
+    for entry in SOURCE_DIRS:
+        full = os.path.join(resources, entry)
+        if os.path.isdir(full):
+            for name in sorted(os.listdir(full)):
+                if name.endswith(".png"):
+                    names.append(entry + "/" + name)
+        elif os.path.isfile(full):
+            names.append(entry)
+    return names
+
+
+def shelf_pack(sizes, atlas_width):
+    """按高度降序逐行摆放，返回每帧左上角坐标与所需总高度"""
+    order = sorted(range(len(sizes)), key=lambda i: (-sizes[i][1], -sizes[i][0]))
+    slots = [None] * len(sizes)
+    margin = PADDING + EXTRUDE
+    x = y = shelf_height = 0
+    for i in order:
+        w, h = sizes[i][0] + margin * 2, sizes[i][1] + margin * 2
+        if w > atlas_width:
+            return None, None
+        if x + w > atlas_width:
+            y += shelf_height
+            x = shelf_height = 0
+        slots[i] = (x + margin, y + margin)
+        x += w
+        shelf_height = max(shelf_height, h)
+    return slots, y + shelf_height
+
+
+def choose_layout(sizes):
+    """在不超过 MAX_SIZE 的 2 的幂尺寸中取面积最小的布局"""
+    best = None
+    width = 64
+    while width <= MAX_SIZE:
+        slots, used_height = shelf_pack(sizes, width)
+        if slots is not None:
+            height = 64
+            while height < used_height:
+                height *= 2
+            # 面积相同时取更接近正方形的尺寸
+            key = (width * height, max(width, height))
+            if height <= MAX_SIZE and (best is None or key < best[0]):
+                best = (key, width, height, slots)
+        width *= 2
+    return best[1:] if best else None
+
+
+def blit(atlas, image, x, y):
+    width, height, rows = image
+    # 外扩：边缘行列向外复制 EXTRUDE 像素
+    for dy in range(-EXTRUDE, height + EXTRUDE):
+        src = rows[min(max(dy, 0), height - 1)]
+        dst = atlas[y + dy]
+        left = src[0:4] * EXTRUDE
+        right = src[-4:] * EXTRUDE
+        start = (x - EXTRUDE) * 4
+        dst[start:start + len(left) + len(src) + len(right)] = left + src + right
+
+
+def write_plist(path, texture_name, atlas_size, frames):
+    lines = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<!DOCTYPE plist PUBLIC "-//Apple Computer//DTD PLIST 1.0//EN" "http://www.apple.com/DTDs/PropertyList-1.0.dtd">',
+        '<plist version="1.0">',
+        '<dict>',
+        '    <key>frames</key>',
+        '    <dict>',
+    ]
+    for name, x, y, w, h in frames:
+        lines += [
+            '        <key>%s</key>' % name,
+            '        <dict>',
+            '            <key>frame</key>',
+            '            <string>{{%d,%d},{%d,%d}}</string>' % (x, y, w, h),
+            '            <key>offset</key>',
+            '            <string>{0,0}</string>',
+            '            <key>rotated</key>',
+            '            <false/>',
+            '            <key>sourceColorRect</key>',
+            '            <string>{{0,0},{%d,%d}}</string>' % (w, h),
+            '            <key>sourceSize</key>',
+            '            <string>{%d,%d}</string>' % (w, h),
+            '        </dict>',
+        ]
+    lines += [
+        '    </dict>',
+        '    <key>metadata</key>',
+        '    <dict>',
+        '        <key>format</key>',
+        '        <integer>2</integer>',
+        '        <key>realTextureFileName</key>',
+        '        <string>%s</string>' % texture_name,
+        '        <key>size</key>',
+        '        <string>{%d,%d}</string>' % atlas_size,
+        '        <key>textureFileName</key>',
+        '        <string>%s</string>' % texture_name,
+        '    </dict>',
+        '</dict>',
+        '</plist>',
+        '',
+    ]
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack card art into a single atlas")
+    parser.add_argument("--resources", default="Resources", help="Resources directory")
+    args = parser.parse_args()
+
+    names = collect_sources(args.resources)
+    if not names:
+        print("pack_card_atlas: no source images found", file=sys.stderr)
+        return 1
+    images = [read_png(os.path.join(args.resources, name)) for name in names]
+
+    layout = choose_layout([(w, h) for w, h, _ in images])
+    if layout is None:
+        print("pack_card_atlas: images do not fit in %dx%d" % (MAX_SIZE, MAX_SIZE), file=sys.stderr)
+        return 1
+    atlas_width, atlas_height, slots = layout
+
+    atlas = [bytearray(atlas_width * 4) for _ in range(atlas_height)]
+    frames = []
+    for name, image, (x, y) in zip(names, images, slots):
+        blit(atlas, image, x, y)
+        frames.append((name, x, y, image[0], image[1]))
+
+    png_path = os.path.join(args.resources, ATLAS_PNG)
+    write_png(png_path, atlas_width, atlas_height, atlas)
+    write_plist(os.path.join(args.resources, ATLAS_PLIST), os.path.basename(ATLAS_PNG),
+                (atlas_width, atlas_height), frames)
+    print("%s: %d frames, %dx%d" % (png_path, len(frames), atlas_width, atlas_height))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
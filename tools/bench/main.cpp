@@ -0,0 +1,325 @@
+/**
+ * bench：核心库基准，复现提交说明与 README 中引用的数字
+ *
+ * 用法：bench [场景...]
+ *   不带参数时依次运行全部场景；数字随机器浮动，比较时以同一台机器上的相对关系为准。
+ *   alloc   每局的堆分配次数：对象池模型每局新建 / 同一模型原地重发 / GameEngine 重开
+ *   moves   单步操作耗时随牌堆大小的变化：标准局到超大牌靴（HUGE_SHOE_CARDS）与单局上限；
+ *           model 行只含 GameModel 的牌堆与桌面操作，engine 行为完整的 GameEngine 操作（含撤销记录与时间线）
+ *   lookup  GameModel::getCardById 单次查找，以及同一牌面上一次匹配加撤销的完整往返
+ *   seek    2000 步对局中随机跳转到任意一步（seekToMove）的平均耗时
+ *   hint    HintService 的单次搜索：标准局开局，提示视界与置换表大小，单线程
+ *   log     单条 EventLog 记录的开销（单线程与 4 线程并发），对照 snprintf 格式化同一条日志；
+ *           直接调用 EventLog::record，不受 EVENT_LOG_LEVEL=0 影响
+ *
+ * 编译（在仓库根目录）：
+ *   g++ -std=c++11 -O2 -pthread -DEVENT_LOG_LEVEL=0 -DALLOC_COUNTER_ENABLED=1 -IClasses tools/bench/main.cpp \
+ *       Classes/core/GameEngine.cpp Classes/services/DealSolver.cpp Classes/services/DealLibrary.cpp \
+ *       Classes/services/GameModelGenerator.cpp Classes/services/RandomService.cpp \
+ *       Classes/managers/UndoManager.cpp Classes/managers/TimelineManager.cpp \
+ *       Classes/utils/MappedFile.cpp Classes/utils/EventLog.cpp Classes/utils/AllocCounter.cpp \
+ *       Classes/models/[A-Z]*.cpp Classes/configs/models/LevelConfig.cpp -o bench
+ */
+#include "core/GameEngine.h"
+#include "services/HintService.h"
+#include "services/RandomService.h"
+#include "utils/AllocCounter.h"
+#include "utils/EventLog.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    // 第 i 局使用种子 BASE_SEED + i，各场景与各次运行发出同样的牌局
+    const uint64_t BASE_SEED = 1;
+
+    // 计算结果写到这里，防止编译器删掉被测循环
+    volatile uintptr_t s_sink = 0;
+
+    struct Scenario
+    {
+        const char* name;
+        void (*run)();
+    };
+
+    double elapsedNs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    // 每项：总分配次数与总耗时按局数平均
+    void printPerDeal(const char* label, uint64_t allocations, double ns, int deals)
+    {
+        std::printf("  %-34s %10.2f allocs/deal %10.0f ns/deal\n", label,
+            static_cast<double>(allocations) / deals, ns / deals);
+    }
+
+    void benchAlloc()
+    {
+        const int DEALS = 100000;
+        std::printf("alloc: %d standard deals\n", DEALS);
+        if (!AllocCounter::isEnabled()) {
+            std::printf("  built without -DALLOC_COUNTER_ENABLED=1, allocation counts unavailable\n");
+        }
+        GameModelGenerator generator;
+
+        // 每局新建并删除对象池模型：池块与容器每局从头分配
+        uint64_t allocations = AllocCounter::getAllocationCount();
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < DEALS; i++) {
+            delete generator.generateRandomGameModel(nullptr, BASE_SEED + i);
+        }
+        printPerDeal("pooled model, recreated per deal", AllocCounter::getAllocationCount() - allocations, elapsedNs(start), DEALS);
+
+        // 同一模型原地重发：对象池与容器容量在首局之后全部复用
+        GameModel* model = generator.generateRandomGameModel(nullptr, BASE_SEED);
+        allocations = AllocCounter::getAllocationCount();
+        start = Clock::now();
+        for (int i = 0; i < DEALS; i++) {
+            generator.generateRandomGameModel(model, BASE_SEED + i);
+        }
+        printPerDeal("redeal in place", AllocCounter::getAllocationCount() - allocations, elapsedNs(start), DEALS);
+        delete model;
+
+        // GameController::restartGame 的路径：发牌并重置撤销记录与时间线
+        GameEngine engine;
+        engine.newRandomGame(BASE_SEED);
+        allocations = AllocCounter::getAllocationCount();
+        start = Clock::now();
+        for (int i = 0; i < DEALS; i++) {
+            engine.newRandomGame(BASE_SEED + i);
+        }
+        printPerDeal("GameEngine::newRandomGame", AllocCounter::getAllocationCount() - allocations, elapsedNs(start), DEALS);
+    }
+
+    // 有可匹配的桌面牌时匹配第一张，否则抽牌；标准局与牌靴模式的牌堆都不会抽空
+    bool playGreedyMove(GameEngine& engine)
+    {
+        const std::vector<CardModel*>& playFieldCards = engine.getGameModel()->getPlayFieldCards();
+        for (CardModel* card : playFieldCards) {
+            if (engine.canMatch(card->getCardId())) return engine.applyMatch(card->getCardId()).applied;
+        }
+        return engine.applyDraw().applied;
+    }
+
+    // 按 GameEngine 的顺序交替做一次抽牌与一次匹配的模型操作，不检查规则
+    void playModelMoves(GameModel* model, int moves)
+    {
+        for (int i = 0; i + 1 < moves; i += 2) {
+            CardModel* drawnCard = model->drawCardFromStack();
+            model->pushCardToStackBottom(model->getBottomCard());
+            model->setBottomCard(drawnCard);
+
+            CardModel* clickedCard = model->getPlayFieldCards().front();
+            CardPosition slot = clickedCard->getPosition();
+            model->removeCardFromPlayField(clickedCard->getCardId());
+            model->pushCardToStackBottom(model->getBottomCard());
+            model->setBottomCard(clickedCard);
+            model->drawCardFromStackToPlayField(slot);
+        }
+    }
+
+    void benchMoves()
+    {
+        const int MOVES = 1000000;
+        const int SHOE_SIZES[] = {
+            GameModelGenerator::DEFAULT_TOTAL_CARDS, 1024,
+            GameModelGenerator::HUGE_SHOE_CARDS, GameModelGenerator::MAX_TOTAL_CARDS,
+        };
+        std::printf("moves: %d moves per shoe size\n", MOVES);
+        GameModelGenerator generator;
+        GameEngine engine;
+        for (int totalCards : SHOE_SIZES) {
+            GameModel* model = generator.generateRandomGameModel(nullptr, BASE_SEED, totalCards);
+            Clock::time_point start = Clock::now();
+            playModelMoves(model, MOVES);
+            double modelNs = elapsedNs(start) / MOVES;
+            delete model;
+
+            engine.newRandomGame(BASE_SEED, totalCards);
+            int played = 0;
+            start = Clock::now();
+            while (played < MOVES && playGreedyMove(engine)) played++;
+            double engineNs = played > 0 ? elapsedNs(start) / played : 0.0;
+            std::printf("  %6d cards   model %8.1f ns/move   engine %8.1f ns/move\n", totalCards, modelNs, engineNs);
+        }
+    }
+
+    void benchLookup()
+    {
+        const int LOOKUPS = 100000000;
+        const int CYCLES = 1000000;
+        GameEngine engine;
+        engine.newRandomGame(BASE_SEED);
+        const GameModel* model = engine.getGameModel();
+
+        // 预先打乱的卡牌ID序列，避免顺序访问让查找显得过快
+        RandomService random(BASE_SEED);
+        std::vector<int> cardIds(4096);
+        for (size_t i = 0; i < cardIds.size(); i++) {
+            cardIds[i] = random.nextInt(0, model->getCardCount() - 1);
+        }
+        uintptr_t checksum = 0;
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < LOOKUPS; i++) {
+            checksum += reinterpret_cast<uintptr_t>(model->getCardById(cardIds[i & 4095]));
+        }
+        double lookupNs = elapsedNs(start) / LOOKUPS;
+        s_sink = checksum;
+
+        // 抽牌直到桌面出现可匹配的牌，再在同一牌面上反复匹配与撤销
+        int cardId = -1;
+        while (cardId < 0) {
+            for (CardModel* card : model->getPlayFieldCards()) {
+                if (engine.canMatch(card->getCardId())) cardId = card->getCardId();
+            }
+            if (cardId < 0) engine.applyDraw();
+        }
+        start = Clock::now();
+        for (int i = 0; i < CYCLES; i++) {
+            engine.applyMatch(cardId);
+            engine.undo();
+        }
+        double cycleNs = elapsedNs(start) / CYCLES;
+
+        std::printf("lookup: standard deal\n");
+        std::printf("  getCardById                %10.2f ns\n", lookupNs);
+        std::printf("  applyMatch + undo          %10.1f ns/cycle\n", cycleNs);
+    }
+
+    void benchSeek()
+    {
+        const int SESSION_MOVES = 2000;
+        const int SEEKS = 200000;
+        GameEngine engine;
+        engine.newRandomGame(BASE_SEED);
+        for (int i = 0; i < SESSION_MOVES; i++) playGreedyMove(engine);
+
+        RandomService random(BASE_SEED);
+        std::vector<int> targets(SEEKS);
+        for (int i = 0; i < SEEKS; i++) {
+            targets[i] = random.nextInt(0, SESSION_MOVES);
+        }
+        Clock::time_point start = Clock::now();
+        for (int target : targets) engine.seekToMove(target);
+        double seekNs = elapsedNs(start) / SEEKS;
+
+        std::printf("seek: %d-move standard session, checkpoint every %d moves\n", SESSION_MOVES,
+            TimelineManager::DEFAULT_CHECKPOINT_INTERVAL);
+        std::printf("  random seekToMove          %10.2f us\n", seekNs / 1000.0);
+    }
+
+    void benchHint()
+    {
+        const int DEALS = 500;
+        DealSolver solver(HintService::DEFAULT_TABLE_BITS);
+        DealSolver::Options options;
+        options.horizon = HintService::DEFAULT_HORIZON;
+
+        GameEngine engine;
+        std::vector<double> solveMs;
+        uint64_t nodes = 0;
+        for (int i = 0; i < DEALS; i++) {
+            engine.newRandomGame(RandomService::deriveSeed(BASE_SEED, i));
+            Clock::time_point start = Clock::now();
+            DealSolver::Result result = solver.solve(engine.getGameModel(), options);
+            solveMs.push_back(elapsedNs(start) / 1e6);
+            nodes += result.nodes;
+        }
+        std::sort(solveMs.begin(), solveMs.end());
+        double totalMs = 0;
+        for (double ms : solveMs) totalMs += ms;
+
+        std::printf("hint: %d opening positions, horizon %d, table 2^%d entries, 1 thread\n", DEALS,
+            static_cast<int>(HintService::DEFAULT_HORIZON), static_cast<int>(HintService::DEFAULT_TABLE_BITS));
+        std::printf("  mean %.3f ms   median %.3f ms   p95 %.3f ms   max %.3f ms   %.0f nodes/solve\n",
+            totalMs / DEALS, solveMs[DEALS / 2], solveMs[DEALS * 95 / 100], solveMs.back(),
+            static_cast<double>(nodes) / DEALS);
+    }
+
+    void benchLog()
+    {
+        const int EVENTS = 10000000;
+        const int THREADS = 4;
+
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < EVENTS; i++) {
+            EventLog::record(LogEventId::MODEL_DRAW_FROM_STACK, i, 49);
+        }
+        double singleNs = elapsedNs(start) / EVENTS;
+
+        std::vector<std::thread> writers;
+        start = Clock::now();
+        for (int t = 0; t < THREADS; t++) {
+            writers.emplace_back([]() {
+                for (int i = 0; i < EVENTS; i++) EventLog::record(LogEventId::MODEL_DRAW_FROM_STACK, i, 49);
+            });
+        }
+        for (std::thread& writer : writers) writer.join();
+        double concurrentNs = elapsedNs(start) / EVENTS;
+
+        // 改用 EVENT_LOG 之前每条日志至少要做的事：按格式串格式化（不含输出）
+        const char* format = LogEvents::formatOf(LogEventId::MODEL_DRAW_FROM_STACK);
+        char line[256];
+        start = Clock::now();
+        for (int i = 0; i < EVENTS; i++) {
+            std::snprintf(line, sizeof(line), format, i, 49);
+            s_sink = static_cast<uintptr_t>(line[sizeof("GameModel: Drew card")]);
+        }
+        double formatNs = elapsedNs(start) / EVENTS;
+
+        std::printf("log: %d events per writer\n", EVENTS);
+        std::printf("  EventLog::record, 1 thread %10.1f ns/event\n", singleNs);
+        std::printf("  EventLog::record, %d threads%9.1f ns/event per writer\n", THREADS, concurrentNs);
+        std::printf("  snprintf of the same line  %10.1f ns/event\n", formatNs);
+    }
+
+    const Scenario SCENARIOS[] = {
+        { "alloc", benchAlloc },
+        { "moves", benchMoves },
+        { "lookup", benchLookup },
+        { "seek", benchSeek },
+        { "hint", benchHint },
+        { "log", benchLog },
+    };
+    const int SCENARIO_COUNT = static_cast<int>(sizeof(SCENARIOS) / sizeof(SCENARIOS[0]));
+
+    void printUsage()
+    {
+        std::fprintf(stderr, "usage: bench [scenario...]\nscenarios:");
+        for (int i = 0; i < SCENARIO_COUNT; i++) std::fprintf(stderr, " %s", SCENARIOS[i].name);
+        std::fprintf(stderr, "\n");
+    }
+
+    const Scenario* findScenario(const char* name)
+    {
+        for (int i = 0; i < SCENARIO_COUNT; i++) {
+            if (std::strcmp(SCENARIOS[i].name, name) == 0) return &SCENARIOS[i];
+        }
+        return nullptr;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // 先核对全部参数，避免跑完一半才发现拼错的场景名
+    for (int i = 1; i < argc; i++) {
+        if (!findScenario(argv[i])) {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (argc == 1) {
+        for (int i = 0; i < SCENARIO_COUNT; i++) SCENARIOS[i].run();
+    } else {
+        for (int i = 1; i < argc; i++) findScenario(argv[i])->run();
+    }
+    return 0;
+}
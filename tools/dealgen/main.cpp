@@ -0,0 +1,115 @@
+/**
+ * dealgen：批量生成牌局库
+ *
+ * 用法：dealgen <输出文件> <局数> [--seed N] [--cards N] [--threads N]
+ *   局数       1 ~ 1000000000
+ *   --seed     基础种子（十进制或 0x 十六进制），默认 1
+ *   --cards    每局牌数，1 ~ 65535，默认 56
+ *   --threads  工作线程数，0 ~ 256，默认 0 即取全部核心
+ * 参数不是完整的非负整数、超出范围或缺少取值时打印用法并退出。
+ *
+ * 编译（在仓库根目录）：
+ *   g++ -std=c++11 -O2 -pthread -DEVENT_LOG_LEVEL=0 -IClasses tools/dealgen/main.cpp \
+ *       Classes/services/DealLibrary.cpp Classes/services/GameModelGenerator.cpp \
+ *       Classes/services/RandomService.cpp Classes/utils/MappedFile.cpp Classes/utils/EventLog.cpp \
+ *       Classes/models/[A-Z]*.cpp Classes/configs/models/LevelConfig.cpp -o dealgen
+ */
+#include "services/DealLibrary.h"
+#include "services/GameModelGenerator.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+    void printUsage()
+    {
+        std::fprintf(stderr, "usage: dealgen <output> <dealCount> [--seed N] [--cards N] [--threads N]\n");
+    }
+
+    const uint64_t MAX_DEAL_COUNT = 1000000000ull; // 56 张一局时约 64 GB
+    const int MAX_THREADS = 256;
+
+    // text 整个是不超过 maxValue 的非负整数时写入 outValue；拒绝负号、空串与尾随字符
+    bool parseUnsigned(const char* text, int base, uint64_t maxValue, uint64_t& outValue)
+    {
+        if (!text || *text < '0' || *text > '9') return false;
+        errno = 0;
+        char* end = nullptr;
+        unsigned long long value = std::strtoull(text, &end, base);
+        if (errno == ERANGE || *end != '\0' || value > maxValue) return false;
+        outValue = value;
+        return true;
+    }
+
+    // 报告无效参数并返回退出码
+    int invalidArgument(const char* name, const char* value)
+    {
+        std::fprintf(stderr, "dealgen: invalid %s '%s'\n", name, value);
+        printUsage();
+        return 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+
+    std::string output = argv[1];
+    uint64_t dealCount = 0;
+    if (!parseUnsigned(argv[2], 10, MAX_DEAL_COUNT, dealCount) || dealCount == 0) {
+        return invalidArgument("deal count", argv[2]);
+    }
+    uint64_t baseSeed = 1;
+    int cards = GameModelGenerator::DEFAULT_TOTAL_CARDS;
+    int threads = 0;
+
+    for (int i = 3; i < argc; i += 2) {
+        const char* flag = argv[i];
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "dealgen: missing value for %s\n", flag);
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[i + 1];
+        uint64_t parsed = 0;
+        if (std::strcmp(flag, "--seed") == 0) {
+            if (!parseUnsigned(value, 0, UINT64_MAX, parsed)) return invalidArgument("seed", value);
+            baseSeed = parsed;
+        } else if (std::strcmp(flag, "--cards") == 0) {
+            if (!parseUnsigned(value, 10, GameModelGenerator::MAX_TOTAL_CARDS, parsed) || parsed == 0) {
+                return invalidArgument("card count", value);
+            }
+            cards = static_cast<int>(parsed);
+        } else if (std::strcmp(flag, "--threads") == 0) {
+            if (!parseUnsigned(value, 10, MAX_THREADS, parsed)) return invalidArgument("thread count", value);
+            threads = static_cast<int>(parsed);
+        } else {
+            std::fprintf(stderr, "dealgen: unknown option %s\n", flag);
+            printUsage();
+            return 1;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool ok = DealLibrary::build(output, baseSeed, dealCount, cards, threads,
+        [](uint64_t written, uint64_t total) {
+            std::fprintf(stderr, "\r%llu / %llu deals", (unsigned long long)written, (unsigned long long)total);
+        });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::fprintf(stderr, "\n");
+
+    if (!ok) {
+        std::fprintf(stderr, "dealgen: failed to write %s\n", output.c_str());
+        return 1;
+    }
+    std::printf("%s: %llu deals x %d cards, record %u bytes, seed %llu, %.2fs\n",
+        output.c_str(), (unsigned long long)dealCount, cards, DealLibrary::recordSizeFor(cards),
+        (unsigned long long)baseSeed, seconds);
+    return 0;
+}
@@ -0,0 +1,478 @@
+/**
+ * dealsim：按策略批量模拟对局，统计得分、连击与抽牌罚分分布，供调整计分规则使用
+ *
+ * 用法：dealsim [--games N] [--seed N] [--cards N] [--moves N] [--policy 列表] [--threads N] [--horizon N]
+ *               [--match-base N] [--combo-bonus N] [--combo-cap N] [--draw-penalty N] [--bucket N]
+ *   --games         模拟局数，默认 1000000
+ *   --seed          基础种子，默认 1；第 i 局的种子为 RandomService::deriveSeed(seed, i)，与 dealgen 一致
+ *   --cards         每局牌数，默认 56
+ *   --moves         每局最多操作步数，默认 100（标准局牌堆永不为空，对局只能由玩家停止）
+ *   --policy        逗号分隔：random, greedy-match, greedy-combo, solver；默认除 solver 外全部
+ *   --threads       工作线程数（按局分配），默认取全部核心
+ *   --horizon       solver 策略的搜索视界，默认 8
+ *   --match-base / --combo-bonus / --combo-cap / --draw-penalty
+ *                   覆盖计分规则（ScoringRules），默认即线上规则
+ *   --bucket        得分直方图的桶宽，默认 25
+ *
+ * 各策略使用同一组牌局，结果只取决于参数，与线程数无关。报告输出到标准输出。
+ *
+ * 编译（在仓库根目录）：
+ *   g++ -std=c++11 -O2 -pthread -DEVENT_LOG_LEVEL=0 -IClasses tools/dealsim/main.cpp Classes/core/GameEngine.cpp \
+ *       Classes/services/DealSolver.cpp Classes/services/DealLibrary.cpp \
+ *       Classes/services/GameModelGenerator.cpp Classes/services/RandomService.cpp \
+ *       Classes/managers/UndoManager.cpp Classes/managers/TimelineManager.cpp \
+ *       Classes/utils/MappedFile.cpp Classes/utils/EventLog.cpp \
+ *       Classes/models/[A-Z]*.cpp Classes/configs/models/LevelConfig.cpp -o dealsim
+ */
+#include "core/GameEngine.h"
+#include "services/DealSolver.h"
+#include "services/MatchRules.h"
+#include "services/RandomService.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    const int MAX_TRACKED_COMBO = 32;   // 连击与罚分次数超过此值的计入最后一格
+    const uint64_t GAMES_PER_BATCH = 256;
+
+    struct SimOptions
+    {
+        uint64_t games = 1000000;
+        uint64_t baseSeed = 1;
+        int cards = GameModelGenerator::DEFAULT_TOTAL_CARDS;
+        int maxMoves = 100;
+        int threads = 0;
+        int horizon = 8;
+        int bucket = 25;
+        ScoringRules scoring;
+    };
+
+    /**
+     * 出牌策略：每局开始时 reset，之后每步给出一个合法操作
+     */
+    class Policy
+    {
+    public:
+        virtual ~Policy() {}
+        virtual void reset(uint64_t gameIndex) { (void)gameIndex; }
+        // @return 没有合法操作时返回 false
+        virtual bool chooseMove(GameEngine& engine, MoveType& type, int& cardId) = 0;
+    };
+
+    // 在全部合法操作（可点击的桌面牌与抽牌）中均匀随机
+    class RandomPolicy : public Policy
+    {
+    public:
+        explicit RandomPolicy(uint64_t baseSeed) : _baseSeed(baseSeed) {}
+
+        void reset(uint64_t gameIndex) override
+        {
+            _random.seed(RandomService::deriveSeed(_baseSeed ^ 0x52414E444F4Dull, gameIndex));
+        }
+
+        bool chooseMove(GameEngine& engine, MoveType& type, int& cardId) override
+        {
+            GameModel* gameModel = engine.getGameModel();
+            _candidates.clear();
+            for (CardModel* card : gameModel->getPlayFieldCards()) {
+                if (engine.canMatch(card->getCardId())) _candidates.push_back(card->getCardId());
+            }
+            bool canDraw = !gameModel->getStackCards().empty();
+            uint32_t choices = static_cast<uint32_t>(_candidates.size()) + (canDraw ? 1 : 0);
+            if (choices == 0) return false;
+
+            uint32_t pick = _random.nextBounded(choices);
+            if (pick < _candidates.size()) {
+                type = MoveType::MATCH;
+                cardId = _candidates[pick];
+            } else {
+                type = MoveType::DRAW;
+            }
+            return true;
+        }
+
+    private:
+        uint64_t _baseSeed;
+        RandomService _random;
+        std::vector<int> _candidates;
+    };
+
+    /**
+     * 能匹配就匹配，否则抽牌
+     * comboAware 为 true 时在可点击的牌中选点击后桌面上可接牌最多的一张（只看明牌，不看牌堆）
+     */
+    class GreedyPolicy : public Policy
+    {
+    public:
+        explicit GreedyPolicy(bool comboAware) : _comboAware(comboAware) {}
+
+        bool chooseMove(GameEngine& engine, MoveType& type, int& cardId) override
+        {
+            GameModel* gameModel = engine.getGameModel();
+            const std::vector<CardModel*>& playField = gameModel->getPlayFieldCards();
+            int bestCard = -1;
+            int bestFollowUps = -1;
+            for (CardModel* card : playField) {
+                if (!engine.canMatch(card->getCardId())) continue;
+                if (!_comboAware) {
+                    bestCard = card->getCardId();
+                    break;
+                }
+                int followUps = 0;
+                for (CardModel* other : playField) {
+                    if (other != card && GameMatchTable::canMatch(other->getKindIndex(), card->getKindIndex())) followUps++;
+                }
+                if (followUps > bestFollowUps) {
+                    bestFollowUps = followUps;
+                    bestCard = card->getCardId();
+                }
+            }
+
+            if (bestCard >= 0) {
+                type = MoveType::MATCH;
+                cardId = bestCard;
+                return true;
+            }
+            if (gameModel->getStackCards().empty()) return false;
+            type = MoveType::DRAW;
+            return true;
+        }
+
+    private:
+        bool _comboAware;
+    };
+
+    /**
+     * 按 DealSolver 在视界内的最优序列出牌，序列走完后从新局面再求解
+     * 求解器知道牌堆顺序，得到的是同一计分规则下的得分上界参考，而非真实玩家水平；
+     * 视界内继续操作不再加分时求解器给出空序列，此时按贪心走一步，保证各策略步数可比
+     */
+    class SolverPolicy : public Policy
+    {
+    public:
+        SolverPolicy(int horizon, const ScoringRules& scoring)
+            : _solver(16)
+            , _fallback(false)
+        {
+            _options.horizon = horizon;
+            _options.scoring = scoring;
+        }
+
+        void reset(uint64_t) override
+        {
+            _plan.clear();
+            _planIndex = 0;
+        }
+
+        bool chooseMove(GameEngine& engine, MoveType& type, int& cardId) override
+        {
+            if (_planIndex >= _plan.size()) {
+                _plan = _solver.solve(engine.getGameModel(), _options).moves;
+                _planIndex = 0;
+                if (_plan.empty()) return _fallback.chooseMove(engine, type, cardId);
+            }
+            const MoveRecord& move = _plan[_planIndex++];
+            type = move.operationType == OperationType::CARD_MATCH ? MoveType::MATCH : MoveType::DRAW;
+            cardId = move.cardId;
+            return true;
+        }
+
+    private:
+        DealSolver _solver;
+        DealSolver::Options _options;
+        GreedyPolicy _fallback;
+        std::vector<MoveRecord> _plan;
+        size_t _planIndex = 0;
+    };
+
+    std::unique_ptr<Policy> createPolicy(const std::string& name, const SimOptions& options)
+    {
+        if (name == "random") return std::unique_ptr<Policy>(new RandomPolicy(options.baseSeed));
+        if (name == "greedy-match") return std::unique_ptr<Policy>(new GreedyPolicy(false));
+        if (name == "greedy-combo") return std::unique_ptr<Policy>(new GreedyPolicy(true));
+        if (name == "solver") return std::unique_ptr<Policy>(new SolverPolicy(options.horizon, options.scoring));
+        return std::unique_ptr<Policy>();
+    }
+
+    /**
+     * 一个策略的统计结果，各线程各持一份，结束后合并
+     */
+    struct Stats
+    {
+        uint64_t games = 0;
+        uint64_t wins = 0;               // 步数上限内到达终局（牌堆空且无可匹配牌）
+        uint64_t stuck = 0;              // 无合法操作而提前结束
+        uint64_t moves = 0;
+        uint64_t matches = 0;
+        uint64_t draws = 0;
+        uint64_t penalizedDraws = 0;
+        double scoreSum = 0;
+        double scoreSquareSum = 0;
+        int scoreMin = 0;
+        int scoreMax = 0;
+        std::map<int, uint64_t> scoreBuckets;      // 桶下界 -> 局数
+        std::vector<uint64_t> chainLengths;        // 连击链长度 -> 次数（链在抽牌或对局结束时断开）
+        std::vector<uint64_t> maxCombos;           // 单局最高连击 -> 局数
+        std::vector<uint64_t> penaltiesPerGame;    // 单局罚分次数 -> 局数
+
+        Stats()
+            : chainLengths(MAX_TRACKED_COMBO + 1, 0)
+            , maxCombos(MAX_TRACKED_COMBO + 1, 0)
+            , penaltiesPerGame(MAX_TRACKED_COMBO + 1, 0)
+        {
+        }
+
+        void merge(const Stats& other)
+        {
+            if (other.games == 0) return;
+            if (games == 0 || other.scoreMin < scoreMin) scoreMin = other.scoreMin;
+            if (games == 0 || other.scoreMax > scoreMax) scoreMax = other.scoreMax;
+            games += other.games;
+            wins += other.wins;
+            stuck += other.stuck;
+            moves += other.moves;
+            matches += other.matches;
+            draws += other.draws;
+            penalizedDraws += other.penalizedDraws;
+            scoreSum += other.scoreSum;
+            scoreSquareSum += other.scoreSquareSum;
+            for (const auto& entry : other.scoreBuckets) scoreBuckets[entry.first] += entry.second;
+            for (int i = 0; i <= MAX_TRACKED_COMBO; i++) {
+                chainLengths[i] += other.chainLengths[i];
+                maxCombos[i] += other.maxCombos[i];
+                penaltiesPerGame[i] += other.penaltiesPerGame[i];
+            }
+        }
+    };
+
+    int clampTracked(int value)
+    {
+        return std::min(value, MAX_TRACKED_COMBO);
+    }
+
+    int bucketOf(int score, int bucket)
+    {
+        // 向下取整，负分同样按桶宽对齐
+        int index = score >= 0 ? score / bucket : -((-score + bucket - 1) / bucket);
+        return index * bucket;
+    }
+
+    void playGame(GameEngine& engine, Policy& policy, uint64_t gameIndex, const SimOptions& options, Stats& stats)
+    {
+        engine.newRandomGame(RandomService::deriveSeed(options.baseSeed, gameIndex), options.cards);
+        policy.reset(gameIndex);
+
+        int chain = 0;
+        int maxCombo = 0;
+        int penalties = 0;
+        int moves = 0;
+        bool won = false;
+        for (; moves < options.maxMoves; moves++) {
+            if (engine.isGameOver()) {
+                won = true;
+                break;
+            }
+            MoveType type = MoveType::DRAW;
+            int cardId = -1;
+            if (!policy.chooseMove(engine, type, cardId)) {
+                stats.stuck++;
+                break;
+            }
+            MoveResult result = engine.applyMove(type, cardId);
+            if (!result.applied) {
+                stats.stuck++;
+                break;
+            }
+            if (result.type == MoveType::MATCH) {
+                stats.matches++;
+                chain = result.combo;
+                maxCombo = std::max(maxCombo, chain);
+            } else {
+                stats.draws++;
+                if (result.penalized) {
+                    stats.penalizedDraws++;
+                    penalties++;
+                }
+                if (chain > 0) stats.chainLengths[clampTracked(chain)]++;
+                chain = 0;
+            }
+        }
+        if (!won && moves == options.maxMoves && engine.isGameOver()) won = true;
+        if (chain > 0) stats.chainLengths[clampTracked(chain)]++;
+
+        int score = engine.getGameModel()->getScore();
+        if (stats.games == 0 || score < stats.scoreMin) stats.scoreMin = score;
+        if (stats.games == 0 || score > stats.scoreMax) stats.scoreMax = score;
+        stats.games++;
+        if (won) stats.wins++;
+        stats.moves += moves;
+        stats.scoreSum += score;
+        stats.scoreSquareSum += static_cast<double>(score) * score;
+        stats.scoreBuckets[bucketOf(score, options.bucket)]++;
+        stats.maxCombos[clampTracked(maxCombo)]++;
+        stats.penaltiesPerGame[clampTracked(penalties)]++;
+    }
+
+    Stats simulate(const std::string& policyName, const SimOptions& options)
+    {
+        std::vector<Stats> threadStats(static_cast<size_t>(options.threads));
+        std::atomic<uint64_t> nextBatch(0);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < options.threads; t++) {
+            workers.emplace_back([&, t]() {
+                std::unique_ptr<GameEngine> engine(new GameEngine());
+                engine->setScoringRules(options.scoring);
+                engine->setUndoDepth(0); // 模拟不撤销，时间线仍照常记录
+                std::unique_ptr<Policy> policy = createPolicy(policyName, options);
+                Stats& stats = threadStats[static_cast<size_t>(t)];
+                for (uint64_t batch = nextBatch.fetch_add(1); batch * GAMES_PER_BATCH < options.games; batch = nextBatch.fetch_add(1)) {
+                    uint64_t end = std::min(options.games, (batch + 1) * GAMES_PER_BATCH);
+                    for (uint64_t i = batch * GAMES_PER_BATCH; i < end; i++) {
+                        playGame(*engine, *policy, i, options, stats);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        Stats total;
+        for (const Stats& stats : threadStats) total.merge(stats);
+        return total;
+    }
+
+    double percent(uint64_t part, uint64_t whole)
+    {
+        return whole ? 100.0 * part / whole : 0.0;
+    }
+
+    void printDistribution(const char* title, const std::vector<uint64_t>& counts, uint64_t total, int first)
+    {
+        std::printf("  %s\n", title);
+        for (int i = first; i <= MAX_TRACKED_COMBO; i++) {
+            if (counts[i] == 0) continue;
+            std::printf("    %3d%s %12llu  %6.2f%%\n", i, i == MAX_TRACKED_COMBO ? "+" : " ",
+                (unsigned long long)counts[i], percent(counts[i], total));
+        }
+    }
+
+    void printReport(const std::string& policyName, const Stats& stats, const SimOptions& options, double seconds)
+    {
+        double games = stats.games ? static_cast<double>(stats.games) : 1.0;
+        double mean = stats.scoreSum / games;
+        double variance = std::max(0.0, stats.scoreSquareSum / games - mean * mean);
+        uint64_t chains = 0;
+        for (uint64_t count : stats.chainLengths) chains += count;
+
+        std::printf("== %s: %llu games, %.2fs (%.0f games/s)\n", policyName.c_str(), (unsigned long long)stats.games,
+            seconds, seconds > 0 ? stats.games / seconds : 0.0);
+        std::printf("  win rate %.3f%% (%llu), stuck %llu, mean moves %.1f\n", percent(stats.wins, stats.games),
+            (unsigned long long)stats.wins, (unsigned long long)stats.stuck, stats.moves / games);
+        std::printf("  score mean %.2f, stddev %.2f, min %d, max %d\n", mean, std::sqrt(variance), stats.scoreMin, stats.scoreMax);
+        std::printf("  matches/game %.2f, draws/game %.2f, penalized draws %.2f%% of draws (%.2f/game)\n",
+            stats.matches / games, stats.draws / games, percent(stats.penalizedDraws, stats.draws), stats.penalizedDraws / games);
+
+        std::printf("  score histogram (bucket %d)\n", options.bucket);
+        uint64_t peak = 1;
+        for (const auto& entry : stats.scoreBuckets) peak = std::max(peak, entry.second);
+        for (const auto& entry : stats.scoreBuckets) {
+            int bar = static_cast<int>(40 * entry.second / peak);
+            std::printf("    [%5d, %5d) %12llu  %6.2f%%  %s\n", entry.first, entry.first + options.bucket,
+                (unsigned long long)entry.second, percent(entry.second, stats.games), std::string(bar, '#').c_str());
+        }
+        printDistribution("combo chain length", stats.chainLengths, chains, 1);
+        printDistribution("max combo per game", stats.maxCombos, stats.games, 0);
+        printDistribution("penalized draws per game", stats.penaltiesPerGame, stats.games, 0);
+    }
+
+    bool splitPolicies(const std::string& list, std::vector<std::string>& outNames)
+    {
+        size_t begin = 0;
+        while (begin <= list.size()) {
+            size_t end = list.find(',', begin);
+            if (end == std::string::npos) end = list.size();
+            std::string name = list.substr(begin, end - begin);
+            if (!createPolicy(name, SimOptions())) {
+                std::fprintf(stderr, "dealsim: unknown policy '%s'\n", name.c_str());
+                return false;
+            }
+            outNames.push_back(name);
+            begin = end + 1;
+        }
+        return !outNames.empty();
+    }
+
+    void printUsage()
+    {
+        std::fprintf(stderr, "usage: dealsim [--games N] [--seed N] [--cards N] [--moves N] [--policy random,greedy-match,greedy-combo,solver]\n"
+            "               [--threads N] [--horizon N] [--match-base N] [--combo-bonus N] [--combo-cap N] [--draw-penalty N] [--bucket N]\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    SimOptions options;
+    std::string policyList = "random,greedy-match,greedy-combo";
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const char* value = argv[i + 1];
+        if (std::strcmp(argv[i], "--games") == 0) {
+            options.games = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            options.baseSeed = std::strtoull(value, nullptr, 0);
+        } else if (std::strcmp(argv[i], "--cards") == 0) {
+            options.cards = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--moves") == 0) {
+            options.maxMoves = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--policy") == 0) {
+            policyList = value;
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            options.threads = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--horizon") == 0) {
+            options.horizon = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--match-base") == 0) {
+            options.scoring.matchBaseScore = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--combo-bonus") == 0) {
+            options.scoring.comboBonus = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--combo-cap") == 0) {
+            options.scoring.comboCap = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--draw-penalty") == 0) {
+            options.scoring.drawPenalty = std::atoi(value);
+        } else if (std::strcmp(argv[i], "--bucket") == 0) {
+            options.bucket = std::atoi(value);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if ((argc - 1) % 2 != 0 || options.bucket <= 0 || options.maxMoves < 0) {
+        printUsage();
+        return 1;
+    }
+    std::vector<std::string> policies;
+    if (!splitPolicies(policyList, policies)) return 1;
+    if (options.threads <= 0) options.threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    const ScoringRules& scoring = options.scoring;
+    std::printf("dealsim: %llu games x %d cards, seed %llu, max %d moves, %d threads\n",
+        (unsigned long long)options.games, options.cards, (unsigned long long)options.baseSeed, options.maxMoves, options.threads);
+    std::printf("scoring: match %d + %d x combo%s, draw penalty %d\n", scoring.matchBaseScore, scoring.comboBonus,
+        scoring.comboCap > 0 ? (" (cap " + std::to_string(scoring.comboCap) + ")").c_str() : "", scoring.drawPenalty);
+
+    for (const std::string& policy : policies) {
+        auto start = std::chrono::steady_clock::now();
+        Stats stats = simulate(policy, options);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printReport(policy, stats, options, seconds);
+    }
+    return 0;
+}
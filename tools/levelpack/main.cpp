@@ -0,0 +1,152 @@
+/**
+ * levelpack：把一批关卡 JSON 编译成二进制关卡包
+ *
+ * 用法：levelpack <输出文件> <关卡目录或 level_N.json>...
+ *   目录下所有 level_N.json 都会被收录，关卡ID取自文件名中的 N
+ *
+ * 编译（在仓库根目录，rapidjson 使用 cocos2d-x 自带的 external/json）：
+ *   g++ -std=c++11 -O2 -IClasses -I<cocos2d>/external tools/levelpack/main.cpp \
+ *       Classes/configs/loaders/LevelPack.cpp Classes/configs/loaders/LevelJsonParser.cpp \
+ *       Classes/configs/models/LevelConfig.cpp Classes/utils/MappedFile.cpp -o levelpack
+ */
+#include "configs/loaders/LevelPack.h"
+#include "configs/loaders/LevelJsonParser.h"
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+    struct LevelSource
+    {
+        int levelId;
+        std::string path;
+    };
+
+    // 从 level_N.json 形式的文件名中取关卡ID，不符合时返回 false
+    bool parseLevelId(const std::string& path, int& levelId)
+    {
+        size_t slash = path.find_last_of("/\\");
+        std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+        int id = 0;
+        char tail = 0;
+        if (std::sscanf(name.c_str(), "level_%d.jso%c", &id, &tail) != 2 || tail != 'n') return false;
+        if (name != "level_" + std::to_string(id) + ".json") return false;
+        levelId = id;
+        return true;
+    }
+
+    void listDirectory(const std::string& dir, std::vector<std::string>& files)
+    {
+#ifdef _WIN32
+        WIN32_FIND_DATAA findData;
+        HANDLE handle = FindFirstFileA((dir + "\\level_*.json").c_str(), &findData);
+        if (handle == INVALID_HANDLE_VALUE) return;
+        do {
+            files.push_back(dir + "\\" + findData.cFileName);
+        } while (FindNextFileA(handle, &findData));
+        FindClose(handle);
+#else
+        DIR* handle = opendir(dir.c_str());
+        if (!handle) return;
+        while (dirent* entry = readdir(handle)) {
+            files.push_back(dir + "/" + entry->d_name);
+        }
+        closedir(handle);
+#endif
+    }
+
+    bool isDirectory(const std::string& path)
+    {
+#ifdef _WIN32
+        DWORD attributes = GetFileAttributesA(path.c_str());
+        return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+        struct stat st;
+        return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+#endif
+    }
+
+    bool readFile(const std::string& path, std::string& content)
+    {
+        std::ifstream in(path.c_str(), std::ios::binary);
+        if (!in) return false;
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        content = ss.str();
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: levelpack <output> <dir|level_N.json>...\n");
+        return 1;
+    }
+
+    std::vector<std::string> candidates;
+    for (int i = 2; i < argc; i++) {
+        if (isDirectory(argv[i])) {
+            listDirectory(argv[i], candidates);
+        } else {
+            candidates.push_back(argv[i]);
+        }
+    }
+
+    std::vector<LevelSource> sources;
+    for (auto& path : candidates) {
+        LevelSource source;
+        if (parseLevelId(path, source.levelId)) {
+            source.path = path;
+            sources.push_back(source);
+        }
+    }
+    if (sources.empty()) {
+        std::fprintf(stderr, "levelpack: no level_N.json found\n");
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<LevelConfig>> configs;
+    std::vector<std::pair<int, const LevelConfig*>> levels;
+    for (auto& source : sources) {
+        std::string content;
+        if (!readFile(source.path, content)) {
+            std::fprintf(stderr, "levelpack: cannot read %s\n", source.path.c_str());
+            return 1;
+        }
+        LevelConfig* config = LevelJsonParser::parse(content);
+        if (!config) {
+            std::fprintf(stderr, "levelpack: JSON parse error in %s\n", source.path.c_str());
+            return 1;
+        }
+        configs.emplace_back(config);
+        levels.push_back(std::make_pair(source.levelId, config));
+    }
+
+    if (!LevelPack::write(argv[1], levels)) {
+        std::fprintf(stderr, "levelpack: failed to write %s (duplicate level id or too many cards?)\n", argv[1]);
+        return 1;
+    }
+
+    // 回读校验
+    LevelPack pack;
+    if (!pack.openFile(argv[1]) || pack.getLevelCount() != static_cast<int>(levels.size())) {
+        std::fprintf(stderr, "levelpack: verification failed for %s\n", argv[1]);
+        return 1;
+    }
+    std::printf("%s: %d levels\n", argv[1], pack.getLevelCount());
+    return 0;
+}
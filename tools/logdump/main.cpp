@@ -0,0 +1,108 @@
+/**
+ * logdump：把客户端写出的二进制事件日志（EventLog::writeDump）格式化为文本
+ *
+ * 用法：logdump <转储文件> [--level N] [--category 列表] [--last N]
+ *   --level     只输出级别不高于 N 的事件（1 ERROR ... 5 VERBOSE），默认全部
+ *   --category  逗号分隔的类别名（MODEL, ENGINE, UNDO, CONTROLLER, VIEW, SERVICE），默认全部
+ *   --last      只输出最后 N 条
+ *
+ * 每行：相对第一条记录的毫秒数、线程序号、级别、类别、正文。
+ * 事件表编译自同一份 Classes/utils/LogEvents.h，转储文件的表散列不一致时给出提示。
+ *
+ * 编译（在仓库根目录）：
+ *   g++ -std=c++11 -O2 -IClasses tools/logdump/main.cpp Classes/utils/EventLog.cpp -o logdump
+ */
+#include "utils/EventLog.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    void printUsage()
+    {
+        std::fprintf(stderr, "usage: logdump <dump> [--level N] [--category MODEL,ENGINE,...] [--last N]\n");
+    }
+
+    bool parseCategories(const std::string& list, uint32_t& outMask)
+    {
+        outMask = 0;
+        size_t begin = 0;
+        while (begin <= list.size()) {
+            size_t end = list.find(',', begin);
+            if (end == std::string::npos) end = list.size();
+            std::string name = list.substr(begin, end - begin);
+            bool found = false;
+            for (int c = 0; c < static_cast<int>(LogCategory::COUNT); c++) {
+                if (name == EventLog::categoryName(static_cast<LogCategory>(c))) {
+                    outMask |= 1u << c;
+                    found = true;
+                }
+            }
+            if (!found) {
+                std::fprintf(stderr, "logdump: unknown category '%s'\n", name.c_str());
+                return false;
+            }
+            begin = end + 1;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    int maxLevel = static_cast<int>(LogLevel::LEVEL_VERBOSE);
+    uint32_t categoryMask = 0xFFFFFFFFu;
+    size_t last = 0;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--level") == 0) {
+            maxLevel = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--category") == 0) {
+            if (!parseCategories(argv[i + 1], categoryMask)) return 1;
+        } else if (std::strcmp(argv[i], "--last") == 0) {
+            last = static_cast<size_t>(std::strtoull(argv[i + 1], nullptr, 10));
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    EventLog::DumpHeader header;
+    std::vector<EventRecord> records;
+    if (!EventLog::readDump(argv[1], header, records)) {
+        std::fprintf(stderr, "logdump: cannot read %s (missing, truncated or not an event log)\n", argv[1]);
+        return 1;
+    }
+    if (header.tableHash != EventLog::tableHash()) {
+        std::fprintf(stderr, "logdump: warning: event table differs from the build that wrote %s, messages may be wrong\n", argv[1]);
+    }
+
+    size_t first = last > 0 && records.size() > last ? records.size() - last : 0;
+    uint64_t origin = records.empty() ? 0 : records[first].timestampNs;
+    uint64_t previousSequence = 0;
+    char message[512];
+    for (size_t i = first; i < records.size(); i++) {
+        const EventRecord& record = records[i];
+        if (previousSequence != 0 && record.sequence != previousSequence + 1) {
+            std::printf("... %llu events overwritten or in flight ...\n",
+                (unsigned long long)(record.sequence - previousSequence - 1));
+        }
+        previousSequence = record.sequence;
+
+        if (record.eventId >= static_cast<uint16_t>(LogEventId::COUNT)) continue;
+        LogEventId id = static_cast<LogEventId>(record.eventId);
+        if (static_cast<int>(LogEvents::levelOf(id)) > maxLevel) continue;
+        if (((categoryMask >> static_cast<int>(LogEvents::categoryOf(id))) & 1u) == 0) continue;
+
+        EventLog::format(record, message, sizeof(message));
+        std::printf("%12.3f ms  T%-2u %-7s %-10s %s\n", (record.timestampNs - origin) / 1e6, record.threadIndex,
+            EventLog::levelName(LogEvents::levelOf(id)), EventLog::categoryName(LogEvents::categoryOf(id)), message);
+    }
+    return 0;
+}